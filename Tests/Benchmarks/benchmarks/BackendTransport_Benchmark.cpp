@@ -0,0 +1,217 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include <benchmark/benchmark.h>
+
+#include <curl/curl.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace {
+
+    const char* const requestBody = "{\"paramList\":[{\"name\":\"Device.DeviceInfo.Manufacturer\"}]}";
+    const char* const responseBody = "{\"paramList\":[{\"name\":\"Device.DeviceInfo.Manufacturer\",\"value\":\"RDK\"}],\"success\":true}";
+
+    /* Minimal keep-alive HTTP/1.1 server standing in for the configuration
+     * backend: every request on a connection gets the same canned answer. */
+    class StandInServer
+    {
+        public:
+            explicit StandInServer(const bool unixSocket)
+                : _listener(-1)
+                , _port(0)
+                , _path()
+            {
+                if (unixSocket)
+                {
+                    _path = "/tmp/devicediagnostics-benchmark-" + std::to_string(getpid()) + ".sock";
+                    unlink(_path.c_str());
+
+                    sockaddr_un address;
+                    memset(&address, 0, sizeof(address));
+                    address.sun_family = AF_UNIX;
+                    strncpy(address.sun_path, _path.c_str(), sizeof(address.sun_path) - 1);
+
+                    _listener = socket(AF_UNIX, SOCK_STREAM, 0);
+                    bind(_listener, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+                }
+                else
+                {
+                    sockaddr_in address;
+                    socklen_t length = sizeof(address);
+                    memset(&address, 0, sizeof(address));
+                    address.sin_family = AF_INET;
+                    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+                    address.sin_port = 0;
+
+                    _listener = socket(AF_INET, SOCK_STREAM, 0);
+                    bind(_listener, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+                    getsockname(_listener, reinterpret_cast<sockaddr*>(&address), &length);
+                    _port = ntohs(address.sin_port);
+                }
+
+                listen(_listener, 64);
+                _acceptor = std::thread(&StandInServer::Accept, this);
+            }
+
+            ~StandInServer()
+            {
+                shutdown(_listener, SHUT_RDWR);
+                close(_listener);
+                _acceptor.join();
+
+                std::lock_guard<std::mutex> lock(_lock);
+                for (std::thread& connection : _connections)
+                {
+                    connection.join();
+                }
+                if (!_path.empty())
+                {
+                    unlink(_path.c_str());
+                }
+            }
+
+            std::string Url() const
+            {
+                return (_path.empty() ? "http://127.0.0.1:" + std::to_string(_port) + "/" : std::string("http://localhost/"));
+            }
+            const std::string& Path() const { return _path; }
+
+        private:
+            void Accept()
+            {
+                int connection;
+                while ((connection = accept(_listener, nullptr, nullptr)) >= 0)
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    _connections.emplace_back(&StandInServer::Serve, connection);
+                }
+            }
+
+            static void Serve(const int connection)
+            {
+                const std::string body(responseBody);
+                const std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+                                             std::to_string(body.size()) + "\r\n\r\n" + body;
+                std::string pending;
+                char buffer[4096];
+                ssize_t received;
+
+                while ((received = recv(connection, buffer, sizeof(buffer), 0)) > 0)
+                {
+                    pending.append(buffer, static_cast<size_t>(received));
+
+                    size_t headerEnd;
+                    while ((headerEnd = pending.find("\r\n\r\n")) != std::string::npos)
+                    {
+                        size_t contentLength = 0;
+                        const size_t field = pending.find("Content-Length:");
+                        if ((field != std::string::npos) && (field < headerEnd))
+                        {
+                            contentLength = strtoul(pending.c_str() + field + 15, nullptr, 10);
+                        }
+                        if (pending.size() < headerEnd + 4 + contentLength)
+                        {
+                            break;
+                        }
+                        pending.erase(0, headerEnd + 4 + contentLength);
+                        send(connection, response.data(), response.size(), MSG_NOSIGNAL);
+                    }
+                }
+                close(connection);
+            }
+
+        private:
+            int _listener;
+            uint16_t _port;
+            std::string _path;
+            std::thread _acceptor;
+            std::mutex _lock;
+            std::list<std::thread> _connections;
+    };
+
+    size_t discard(void*, size_t size, size_t nmemb, void*)
+    {
+        return size * nmemb;
+    }
+
+    /* Same options getConfig sets, minus the response parsing */
+    void prepare(CURL* handle, const StandInServer& server)
+    {
+        curl_easy_setopt(handle, CURLOPT_URL, server.Url().c_str());
+        if (!server.Path().empty())
+        {
+            curl_easy_setopt(handle, CURLOPT_UNIX_SOCKET_PATH, server.Path().c_str());
+        }
+        curl_easy_setopt(handle, CURLOPT_POSTFIELDS, requestBody);
+        curl_easy_setopt(handle, CURLOPT_POSTFIELDSIZE, static_cast<long>(strlen(requestBody)));
+        curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, discard);
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT, 30L);
+    }
+
+    /* range(0): 0 = loopback TCP, 1 = unix domain socket
+     * range(1): 0 = new handle (and connection) per request, 1 = pooled keep-alive handle */
+    void BM_BackendTransport(benchmark::State& state)
+    {
+        const bool unixSocket = (state.range(0) == 1);
+        const bool keepAlive = (state.range(1) == 1);
+        StandInServer server(unixSocket);
+        CURL* pooled = (keepAlive ? curl_easy_init() : nullptr);
+        uint64_t failures = 0;
+
+        for (auto _ : state)
+        {
+            CURL* handle = (keepAlive ? pooled : curl_easy_init());
+            prepare(handle, server);
+            if (curl_easy_perform(handle) != CURLE_OK)
+            {
+                failures++;
+            }
+            if (!keepAlive)
+            {
+                curl_easy_cleanup(handle);
+            }
+        }
+
+        if (pooled != nullptr)
+        {
+            curl_easy_cleanup(pooled);
+        }
+        state.SetLabel(std::string(unixSocket ? "unix" : "tcp") + (keepAlive ? "/keep-alive" : "/connect-per-request"));
+        state.counters["failures"] = static_cast<double>(failures);
+    }
+
+} // namespace
+
+BENCHMARK(BM_BackendTransport)
+    ->ArgNames({ "unix", "keepalive" })
+    ->Args({ 0, 0 })->Args({ 1, 0 })->Args({ 0, 1 })->Args({ 1, 1 })
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
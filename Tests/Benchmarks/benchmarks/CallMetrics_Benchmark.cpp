@@ -0,0 +1,86 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+
+#include "CallMetrics.h"
+
+using WPEFramework::Plugin::CallMetrics;
+
+namespace {
+
+    /* Stands in for GetAVDecoderStatus: a seqlock style snapshot read */
+    std::atomic<uint32_t> status(2);
+
+    uint32_t method(uint32_t& result)
+    {
+        result = status.load(std::memory_order_acquire);
+        return 0;
+    }
+
+    CallMetrics metrics;
+
+    void BM_Unmeasured(benchmark::State& state)
+    {
+        uint32_t result = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(method(result));
+        }
+    }
+
+    /* Same call with the bookkeeping every IDeviceDiagnostics method does:
+     * two clock reads, a histogram bucket and three counters. With threads
+     * all of them hit the same counters, as concurrent callers would. */
+    void BM_Measured(benchmark::State& state)
+    {
+        uint32_t result = 0;
+        for (auto _ : state)
+        {
+            CallMetrics::Call call(metrics);
+            benchmark::DoNotOptimize(call.Result(method(result)));
+        }
+        if (state.thread_index() == 0)
+        {
+            const CallMetrics::Summary summary = metrics.Get();
+            state.counters["p99_us"] = static_cast<double>(summary.latency.p99);
+            metrics.Reset();
+        }
+    }
+
+    void BM_Summary(benchmark::State& state)
+    {
+        for (int call = 0; call < 100000; call++)
+        {
+            CallMetrics::Call measured(metrics);
+        }
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(metrics.Get());
+        }
+        metrics.Reset();
+    }
+
+} // namespace
+
+BENCHMARK(BM_Unmeasured);
+BENCHMARK(BM_Measured)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK(BM_Summary)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,110 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "DecoderHistory.h"
+#include "DecoderPollScheduler.h"
+#include "SimulatedDecoderStatusSource.h"
+
+using WPEFramework::Plugin::DecoderHistory;
+using WPEFramework::Plugin::DecoderPollScheduler;
+using WPEFramework::Plugin::DecoderStatusSource;
+using WPEFramework::Plugin::SimulatedDecoderStatusSource;
+
+namespace {
+
+    /* Simulated time, one poll per ms */
+    uint64_t now = 0;
+
+    /* Every decoder cycles IDLE, ACTIVE, PAUSED, each state lasting period ms,
+     * the decoders staggered by one ms so their transitions do not line up */
+    std::string makeTrace(const int decoders, const int period)
+    {
+        static const char* const states[] = { "IDLE", "ACTIVE", "PAUSED" };
+        std::ostringstream trace;
+
+        for (int decoder = 0; decoder < decoders; decoder++)
+        {
+            const char* const type = ((decoder % 2) == 0 ? "video" : "audio");
+            for (int step = 0; step < 3; step++)
+            {
+                trace << (decoder + (step * period)) << ' ' << type << ' ' << (decoder / 2) << ' ' << states[step] << '\n';
+            }
+        }
+        trace << (3 * period) << " end\n";
+        return trace.str();
+    }
+
+    /* One pass of the AV poll thread: the most active status, every decoder's
+     * state, the poll interval and the history, without the event dispatch.
+     * range(0): decoders, range(1): ms each decoder stays in a state */
+    void BM_PollPass(benchmark::State& state)
+    {
+        const int decoders = static_cast<int>(state.range(0));
+        std::istringstream trace(makeTrace(decoders, static_cast<int>(state.range(1))));
+        SimulatedDecoderStatusSource source("", 100, 0, []() { return now; });
+        DecoderPollScheduler scheduler(1, 1);
+        DecoderHistory history(DecoderStatusSource::IDLE, now);
+        std::vector<DecoderStatusSource::Decoder> list;
+        std::vector<int> last;
+        int lastStatus = DecoderStatusSource::IDLE;
+        uint64_t transitions = 0;
+
+        source.Load(trace);
+        source.Decoders(list);
+        last.assign(list.size(), DecoderStatusSource::IDLE);
+
+        for (auto _ : state)
+        {
+            now++;
+
+            const int status = source.MostActive();
+            for (size_t index = 0; index < list.size(); index++)
+            {
+                int decoderState = DecoderStatusSource::IDLE;
+                if ((source.DecoderState(list[index].type, list[index].id, decoderState)) && (decoderState != last[index]))
+                {
+                    last[index] = decoderState;
+                    transitions++;
+                }
+            }
+            benchmark::DoNotOptimize(scheduler.Polled(status));
+
+            if (status != lastStatus)
+            {
+                history.Record(status, now);
+                lastStatus = status;
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+        state.counters["decoder_transitions"] = benchmark::Counter(static_cast<double>(transitions), benchmark::Counter::kIsRate);
+    }
+
+} // namespace
+
+BENCHMARK(BM_PollPass)
+    ->ArgNames({ "decoders", "period" })
+    ->Args({ 2, 1000 })->Args({ 2, 10 })->Args({ 16, 10 })->Args({ 64, 10 })->Args({ 64, 1 });
@@ -0,0 +1,181 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "SeqLock.h"
+
+using WPEFramework::Plugin::SeqLock;
+
+namespace {
+
+    struct DecoderStatus
+    {
+        int32_t status;
+        uint64_t timestamp;
+    };
+
+    /* Stand-in for EssRMgrGetAVState: a short call into the resource
+     * manager, modelled as about a microsecond of work. */
+    int queryResourceManager()
+    {
+        const auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(1);
+        while (std::chrono::steady_clock::now() < end)
+            ;
+        return 2;
+    }
+
+    /* The AV poll thread, reading the status once per millisecond */
+    class Poller
+    {
+        public:
+            template <typename POLL>
+            explicit Poller(const POLL& poll)
+                : _running(true)
+                , _thread([this, poll]() {
+                    while (_running.load(std::memory_order_relaxed) == true)
+                    {
+                        poll();
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                })
+            {
+            }
+            ~Poller()
+            {
+                _running = false;
+                _thread.join();
+            }
+
+        private:
+            std::atomic<bool> _running;
+            std::thread _thread;
+    };
+
+    std::mutex statusLock;
+    SeqLock<DecoderStatus> snapshot;
+    Poller* poller = nullptr;
+
+    /* What GetAVDecoderStatus did before: every reader takes the lock the
+     * poll thread uses and queries the resource manager itself. */
+    void BM_LockedQuery(benchmark::State& state)
+    {
+        if (state.thread_index() == 0)
+        {
+            poller = new Poller([]() {
+                std::lock_guard<std::mutex> lock(statusLock);
+                benchmark::DoNotOptimize(queryResourceManager());
+            });
+        }
+
+        for (auto _ : state)
+        {
+            std::lock_guard<std::mutex> lock(statusLock);
+            benchmark::DoNotOptimize(queryResourceManager());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+        if (state.thread_index() == 0)
+        {
+            delete poller;
+            poller = nullptr;
+        }
+    }
+
+    /* GetAVDecoderStatus: readers take the snapshot the poll thread publishes */
+    void BM_SnapshotRead(benchmark::State& state)
+    {
+        if (state.thread_index() == 0)
+        {
+            poller = new Poller([]() {
+                DecoderStatus status;
+                status.status = queryResourceManager();
+                status.timestamp = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+                snapshot.Store(status);
+            });
+        }
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(snapshot.Load());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+        if (state.thread_index() == 0)
+        {
+            delete poller;
+            poller = nullptr;
+        }
+    }
+
+    /* getAVDecoderStatusSnapshot with fresh set: a reader that waited for
+     * the lock while another read started takes that read's result */
+    std::atomic<uint32_t> reads(0);
+    std::atomic<uint64_t> queries(0);
+
+    DecoderStatus freshQuery()
+    {
+        const uint32_t started = reads.load();
+        std::lock_guard<std::mutex> lock(statusLock);
+        if (reads.load() != started)
+        {
+            return snapshot.Load();
+        }
+        reads++;
+        queries++;
+        DecoderStatus status;
+        status.status = queryResourceManager();
+        status.timestamp = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+        snapshot.Store(status);
+        return status;
+    }
+
+    void BM_FreshQuery(benchmark::State& state)
+    {
+        if (state.thread_index() == 0)
+        {
+            queries = 0;
+            poller = new Poller([]() { freshQuery(); });
+        }
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(freshQuery());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+        if (state.thread_index() == 0)
+        {
+            delete poller;
+            poller = nullptr;
+            state.counters["queries"] = benchmark::Counter(static_cast<double>(queries.load()), benchmark::Counter::kIsRate);
+        }
+    }
+
+} // namespace
+
+BENCHMARK(BM_LockedQuery)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_SnapshotRead)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_FreshQuery)->ThreadRange(1, 16)->UseRealTime();
@@ -0,0 +1,315 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "DeliveryQueue.h"
+#include "SubscriberFilter.h"
+#include "SubscriberList.h"
+
+using WPEFramework::Plugin::DeliveryQueue;
+using WPEFramework::Plugin::SubscriberFilter;
+using WPEFramework::Plugin::SubscriberList;
+
+/* Heap accounting, so the benchmarks can report the allocations one event
+ * costs next to the events per second. */
+static std::atomic<size_t> allocations(0);
+
+void* operator new(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void* block = malloc(size);
+    if (block == nullptr)
+        throw std::bad_alloc();
+    return block;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+namespace {
+
+    const char* const statusNames[] = { "IDLE", "PAUSED", "ACTIVE" };
+
+    /* Stand-in for a JSON object: keys and values kept as text, serialized on request */
+    class Object
+    {
+        public:
+            void Set(const std::string& key, const std::string& value) { _members[key] = value; }
+
+            std::string String() const
+            {
+                std::string text = "{";
+                for (const auto& member : _members)
+                {
+                    if (text.size() > 1)
+                        text += ',';
+                    text += '"' + member.first + "\":\"" + member.second + '"';
+                }
+                return text + '}';
+            }
+
+        private:
+            std::map<std::string, std::string> _members;
+    };
+
+    /* A subscriber as the COM-RPC interface sees it */
+    class Subscriber
+    {
+        public:
+            virtual ~Subscriber() = default;
+            virtual void OnAVDecoderStatusChanged(const std::string& status)
+            {
+                benchmark::DoNotOptimize(status.data());
+            }
+    };
+
+    /* Before: the event is built as an object per change, copied into a newly
+     * allocated Job, copied again into Dispatch and turned into text once per
+     * subscriber. */
+    class CopyingJob
+    {
+        public:
+            explicit CopyingJob(const Object params) : _params(params) {}
+            void Dispatch(const std::vector<Subscriber*>& subscribers) { Deliver(_params, subscribers); }
+
+        private:
+            static void Deliver(const Object params, const std::vector<Subscriber*>& subscribers)
+            {
+                for (Subscriber* subscriber : subscribers)
+                    subscriber->OnAVDecoderStatusChanged(params.String());
+            }
+
+            Object _params;
+    };
+
+    /* After: the three possible payloads are serialized once, Jobs come back
+     * to a free list after dispatch and every subscriber reads the same text. */
+    class PooledJob
+    {
+        public:
+            void Set(const std::shared_ptr<const std::string>& payload) { _payload = payload; }
+            void Dispatch(const std::vector<Subscriber*>& subscribers)
+            {
+                for (Subscriber* subscriber : subscribers)
+                    subscriber->OnAVDecoderStatusChanged(*_payload);
+                _payload.reset();
+            }
+
+        private:
+            std::shared_ptr<const std::string> _payload;
+    };
+
+    class JobPool
+    {
+        public:
+            ~JobPool()
+            {
+                for (PooledJob* job : _free)
+                    delete job;
+            }
+            PooledJob* Element()
+            {
+                if (_free.empty())
+                    return new PooledJob();
+                PooledJob* job = _free.back();
+                _free.pop_back();
+                return job;
+            }
+            void Release(PooledJob* job) { _free.push_back(job); }
+
+        private:
+            std::vector<PooledJob*> _free;
+    };
+
+    std::vector<Subscriber*> makeSubscribers(const int count)
+    {
+        std::vector<Subscriber*> subscribers;
+        for (int index = 0; index < count; index++)
+            subscribers.push_back(new Subscriber());
+        return subscribers;
+    }
+
+    void deleteSubscribers(std::vector<Subscriber*>& subscribers)
+    {
+        for (Subscriber* subscriber : subscribers)
+            delete subscriber;
+    }
+
+    /* range(0): subscribers */
+    void BM_CopyingJob(benchmark::State& state)
+    {
+        std::vector<Subscriber*> subscribers = makeSubscribers(static_cast<int>(state.range(0)));
+        int status = 0;
+        const size_t before = allocations.load();
+
+        for (auto _ : state)
+        {
+            Object params;
+            params.Set("avDecoderStatusChange", statusNames[status]);
+            CopyingJob* job = new CopyingJob(params);
+            job->Dispatch(subscribers);
+            delete job;
+            status = (status + 1) % 3;
+        }
+        state.counters["allocs_per_event"] = static_cast<double>(allocations.load() - before) / static_cast<double>(state.iterations());
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+        deleteSubscribers(subscribers);
+    }
+
+    void BM_PooledJob(benchmark::State& state)
+    {
+        std::vector<Subscriber*> subscribers = makeSubscribers(static_cast<int>(state.range(0)));
+        std::shared_ptr<const std::string> payloads[3];
+        JobPool pool;
+        int status = 0;
+
+        for (int index = 0; index < 3; index++)
+        {
+            Object params;
+            params.Set("avDecoderStatusChange", statusNames[index]);
+            payloads[index] = std::make_shared<const std::string>(params.String());
+        }
+
+        const size_t before = allocations.load();
+        for (auto _ : state)
+        {
+            PooledJob* job = pool.Element();
+            job->Set(payloads[status]);
+            job->Dispatch(subscribers);
+            pool.Release(job);
+            status = (status + 1) % 3;
+        }
+        state.counters["allocs_per_event"] = static_cast<double>(allocations.load() - before) / static_cast<double>(state.iterations());
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+        deleteSubscribers(subscribers);
+    }
+
+    struct QueuedEvent
+    {
+        uint64_t sequence;
+        std::shared_ptr<const std::string> payload;
+    };
+
+    /* One registration as dispatchEvent sees it: the filter checked before
+     * queueing, the subscriber's own queue and the sink the drain calls */
+    struct QueuedSubscriber
+    {
+        QueuedSubscriber(const uint8_t states)
+            : sink()
+            , filter(0, states, 0)
+            , queue(64, DeliveryQueue<QueuedEvent>::DROP_OLDEST, [](const QueuedEvent&, const QueuedEvent&) { return true; })
+        {
+        }
+        const void* Sink() const { return &sink; }
+
+        Subscriber sink;
+        SubscriberFilter<QueuedEvent> filter;
+        DeliveryQueue<QueuedEvent> queue;
+    };
+
+    /* The current path end to end, without the worker pool: every change is
+     * offered to each subscriber's filter, pushed to its queue and drained.
+     * range(0): subscribers
+     * range(1): 0 = no filters, 1 = every subscriber only wants ACTIVE */
+    void BM_QueuedFanout(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+        const bool filtered = (state.range(1) == 1);
+        SubscriberList<QueuedSubscriber> subscribers;
+        std::shared_ptr<const std::string> payloads[3];
+        std::vector<QueuedSubscriber*> drains;
+        uint64_t sequence = 0;
+        uint64_t delivered = 0;
+        int status = 0;
+
+        for (int index = 0; index < count; index++)
+        {
+            subscribers.Add(std::make_shared<QueuedSubscriber>(filtered ? (1 << 2) : 0));
+        }
+        for (int index = 0; index < 3; index++)
+        {
+            Object params;
+            params.Set("avDecoderStatusChange", statusNames[index]);
+            payloads[index] = std::make_shared<const std::string>(params.String());
+        }
+        drains.reserve(count);
+
+        const size_t before = allocations.load();
+        for (auto _ : state)
+        {
+            const QueuedEvent event = { ++sequence, payloads[status] };
+            const auto snapshot = subscribers.Get();
+
+            for (const auto& subscriber : *snapshot)
+            {
+                bool schedule = false;
+                if ((!subscriber->filter.Open()) &&
+                    (subscriber->filter.Offer(event, 1, static_cast<uint8_t>(1 << status), "av", sequence, schedule) != SubscriberFilter<QueuedEvent>::PASS))
+                {
+                    continue;
+                }
+                if (subscriber->queue.Push(event, sequence) == DeliveryQueue<QueuedEvent>::START)
+                {
+                    drains.push_back(subscriber.get());
+                }
+            }
+
+            for (QueuedSubscriber* subscriber : drains)
+            {
+                QueuedEvent queued;
+                uint64_t at;
+                while (subscriber->queue.Pop(queued, at) == true)
+                {
+                    subscriber->sink.OnAVDecoderStatusChanged(*queued.payload);
+                    subscriber->queue.Delivered(0);
+                    delivered++;
+                }
+            }
+            drains.clear();
+            status = (status + 1) % 3;
+        }
+        state.counters["allocs_per_event"] = static_cast<double>(allocations.load() - before) / static_cast<double>(state.iterations());
+        state.counters["deliveries_per_event"] = static_cast<double>(delivered) / static_cast<double>(state.iterations());
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    }
+
+} // namespace
+
+BENCHMARK(BM_CopyingJob)->ArgName("subscribers")->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_PooledJob)->ArgName("subscribers")->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_QueuedFanout)
+    ->ArgNames({ "subscribers", "filtered" })
+    ->Args({ 1, 0 })->Args({ 10, 0 })->Args({ 100, 0 })->Args({ 1000, 0 })->Args({ 1000, 1 });
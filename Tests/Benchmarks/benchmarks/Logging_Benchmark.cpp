@@ -0,0 +1,134 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <string>
+
+/* Stand-in for the one Thunder helper the logging macros use */
+namespace WPEFramework {
+namespace Core {
+    inline const char* FileNameOnly(const char* fileName)
+    {
+        const char* last = fileName;
+        for (const char* current = fileName; *current != '\0'; current++)
+        {
+            if (*current == '/')
+                last = current + 1;
+        }
+        return last;
+    }
+}
+}
+
+#include "UtilsLogging.h"
+
+/* The macro every call went through before records were queued */
+#define LEGACY_LOGINFO(fmt, ...) do { fprintf(stderr, "[%d] INFO [%s:%d] %s: " fmt "\n", (int)syscall(SYS_gettid), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__); fflush(stderr); } while (0)
+
+namespace {
+
+    /* The logs are not what is measured, keep them off the terminal */
+    struct DiscardStderr
+    {
+        DiscardStderr()
+        {
+            if (freopen("/dev/null", "w", stderr) == nullptr)
+            {
+                perror("freopen");
+            }
+        }
+    } discardStderr;
+
+    /* A getConfiguration request body with the given number of parameters */
+    std::string makeRequest(const int count)
+    {
+        std::string request = "{\"paramList\":[";
+        for (int index = 0; index < count; index++)
+        {
+            if (index > 0)
+                request += ",";
+            request += "{\"name\":\"Device.X_RDKCENTRAL-COM.Parameter." + std::to_string(index) + "\"}";
+        }
+        request += "]}";
+        return request;
+    }
+
+    /* range(0): parameters in the logged request body */
+    void BM_LegacyLog(benchmark::State& state)
+    {
+        const std::string request = makeRequest(static_cast<int>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            LEGACY_LOGINFO("request %u data: %s", 1u, request.c_str());
+        }
+        state.SetLabel(std::to_string(request.size()) + " byte body");
+    }
+
+    void BM_QueuedLog(benchmark::State& state)
+    {
+        const std::string request = makeRequest(static_cast<int>(state.range(0)));
+        const uint64_t dropped = Utils::Logging::Writer::Instance().Dropped();
+        Utils::Logging::SetLevel(LOG_LEVEL_INFO);
+        Utils::Logging::SetRateLimit(0);
+
+        for (auto _ : state)
+        {
+            LOGINFO("request %u data: %s", 1u, request.c_str());
+        }
+        state.SetLabel(std::to_string(request.size()) + " byte body");
+        state.counters["dropped"] = static_cast<double>(Utils::Logging::Writer::Instance().Dropped() - dropped);
+    }
+
+    /* The same statement repeated past the per site limit */
+    void BM_RateLimitedLog(benchmark::State& state)
+    {
+        const std::string request = makeRequest(static_cast<int>(state.range(0)));
+        Utils::Logging::SetLevel(LOG_LEVEL_INFO);
+        Utils::Logging::SetRateLimit(20);
+
+        for (auto _ : state)
+        {
+            LOGINFO("request %u data: %s", 1u, request.c_str());
+        }
+        state.SetLabel(std::to_string(request.size()) + " byte body");
+    }
+
+    /* Runtime level below INFO, nothing is formatted */
+    void BM_DisabledLog(benchmark::State& state)
+    {
+        const std::string request = makeRequest(static_cast<int>(state.range(0)));
+        Utils::Logging::SetLevel(LOG_LEVEL_WARN);
+
+        for (auto _ : state)
+        {
+            LOGINFO("request %u data: %s", 1u, request.c_str());
+        }
+        state.SetLabel(std::to_string(request.size()) + " byte body");
+        Utils::Logging::SetLevel(LOG_LEVEL_INFO);
+    }
+
+} // namespace
+
+BENCHMARK(BM_LegacyLog)->Arg(1)->Arg(100)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_QueuedLog)->Arg(1)->Arg(100)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_RateLimitedLog)->Arg(1)->Arg(100)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_DisabledLog)->Arg(1)->Arg(100)->Unit(benchmark::kNanosecond);
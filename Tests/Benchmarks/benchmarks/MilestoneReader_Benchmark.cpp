@@ -0,0 +1,145 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <string>
+
+#include "MilestoneReader.h"
+
+using WPEFramework::Plugin::MilestoneReader;
+
+namespace {
+
+    /* A milestone log as the RDK logger writes it, one "MARKER:<uptime ms>" per line */
+    class MilestoneLog
+    {
+        public:
+            explicit MilestoneLog(const int lines)
+                : _path("/tmp/devicediagnostics-benchmark-" + std::to_string(getpid()) + "-" + std::to_string(lines) + ".log")
+            {
+                std::ofstream file(_path.c_str(), std::ios::out | std::ios::trunc);
+                for (int line = 0; line < lines; line++)
+                {
+                    file << (line % 10 == 0 ? "APP_LAUNCH_" : "BOOT_STAGE_") << line << ":" << (1000 + line * 7) << "\n";
+                }
+            }
+            ~MilestoneLog()
+            {
+                remove(_path.c_str());
+            }
+
+            const std::string& Path() const { return _path; }
+
+        private:
+            std::string _path;
+    };
+
+    /* getFileContent, which GetMilestones used before the MilestoneReader */
+    bool legacyRead(const std::string& fileName, std::list<std::string>& listOfStrs)
+    {
+        std::ifstream inFile(fileName.c_str(), std::ios::in);
+
+        if (!inFile.is_open())
+            return false;
+
+        std::string line;
+        while (std::getline(inFile, line)) {
+            if (line.size() > 0) {
+                listOfStrs.push_back(line);
+            }
+        }
+        return true;
+    }
+
+    /* range(0): lines in the log */
+    void BM_LegacyRead(benchmark::State& state)
+    {
+        const MilestoneLog log(static_cast<int>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            std::list<std::string> lines;
+            legacyRead(log.Path(), lines);
+            benchmark::DoNotOptimize(lines);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    /* First GetMilestones after start up: map the file and index every line */
+    void BM_ReaderColdRead(benchmark::State& state)
+    {
+        const MilestoneLog log(static_cast<int>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            MilestoneReader reader(log.Path());
+            std::list<std::string> lines;
+            reader.Read(lines);
+            benchmark::DoNotOptimize(lines);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    /* Every later GetMilestones on an unchanged log: the index is reused */
+    void BM_ReaderRead(benchmark::State& state)
+    {
+        const MilestoneLog log(static_cast<int>(state.range(0)));
+        MilestoneReader reader(log.Path());
+
+        for (auto _ : state)
+        {
+            std::list<std::string> lines;
+            reader.Read(lines);
+            benchmark::DoNotOptimize(lines);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    /* queryMilestones for the first page of one marker prefix */
+    void BM_ReaderQuery(benchmark::State& state)
+    {
+        const MilestoneLog log(static_cast<int>(state.range(0)));
+        MilestoneReader reader(log.Path());
+        MilestoneReader::Filter filter;
+        filter.since = 0;
+        filter.until = 0;
+        filter.prefix = "APP_LAUNCH_";
+        uint32_t total = 0;
+
+        for (auto _ : state)
+        {
+            std::list<std::string> lines;
+            reader.Query(filter, 0, 20, lines, total);
+            benchmark::DoNotOptimize(lines);
+        }
+        state.counters["matches"] = static_cast<double>(total);
+    }
+
+} // namespace
+
+BENCHMARK(BM_LegacyRead)->ArgName("lines")->Arg(100)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ReaderColdRead)->ArgName("lines")->Arg(100)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ReaderRead)->ArgName("lines")->Arg(100)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ReaderQuery)->ArgName("lines")->Arg(100)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
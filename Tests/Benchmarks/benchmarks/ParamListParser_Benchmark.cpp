@@ -0,0 +1,159 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <list>
+#include <new>
+#include <string>
+
+#include "ParamListParser.h"
+
+using WPEFramework::Plugin::ParamListParser;
+
+/* Heap accounting, so the benchmarks can report the peak memory a parse needs
+ * next to its run time. Every block carries its size in a small header. */
+static std::atomic<size_t> heapInUse(0);
+static std::atomic<size_t> heapPeak(0);
+
+void* operator new(size_t size)
+{
+    void* block = malloc(size + sizeof(max_align_t));
+    if (block == nullptr)
+        throw std::bad_alloc();
+    *static_cast<size_t*>(block) = size;
+    const size_t inUse = heapInUse.fetch_add(size) + size;
+    size_t peak = heapPeak.load();
+    while ((inUse > peak) && (heapPeak.compare_exchange_weak(peak, inUse) == false))
+        ;
+    return static_cast<char*>(block) + sizeof(max_align_t);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (pointer != nullptr)
+    {
+        void* block = static_cast<char*>(pointer) - sizeof(max_align_t);
+        heapInUse.fetch_sub(*static_cast<size_t*>(block));
+        free(block);
+    }
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+namespace {
+
+    struct ParamList
+    {
+        std::string name;
+        std::string value;
+    };
+
+    /* curl hands the body over in chunks of at most CURL_MAX_WRITE_SIZE */
+    constexpr size_t curlChunkSize = 16384;
+
+    std::string makeResponse(const int count)
+    {
+        std::string response = "{\"paramList\":[";
+        for (int index = 0; index < count; index++)
+        {
+            if (index > 0)
+                response += ",";
+            response += "{\"name\":\"Device.X_RDKCENTRAL-COM.Parameter." + std::to_string(index) +
+                        "\",\"value\":\"value-" + std::to_string(index) + "\"}";
+        }
+        response += "],\"statusCode\":0}";
+        return response;
+    }
+
+    /* The substring based parser getConfig used before the streaming one:
+     * the body is accumulated in full by the write callback, then scanned. */
+    void legacyParse(const std::string& response, std::list<ParamList>& paramListInfo)
+    {
+        ParamList param;
+        std::string::size_type start = 0, end = 0;
+        while ((start = response.find("\"name\":", end)) != std::string::npos)
+        {
+            start = response.find("\"", start + 6) + 1;
+            end = response.find("\"", start);
+            param.name = response.substr(start, end - start);
+
+            start = response.find("\"value\":", end) + 8;
+            end = response.find("}", start);
+            param.value = response.substr(start, end - start);
+
+            paramListInfo.push_back(param);
+        }
+    }
+
+    void BM_LegacyParser(benchmark::State& state)
+    {
+        const std::string response = makeResponse(static_cast<int>(state.range(0)));
+        const size_t baseline = heapInUse.load();
+        heapPeak.store(baseline);
+
+        for (auto _ : state)
+        {
+            std::string buffer;
+            for (size_t offset = 0; offset < response.size(); offset += curlChunkSize)
+                buffer.append(response, offset, std::min(curlChunkSize, response.size() - offset));
+
+            std::list<ParamList> paramListInfo;
+            legacyParse(buffer, paramListInfo);
+            benchmark::DoNotOptimize(paramListInfo);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(response.size()));
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+        state.counters["peak_heap_bytes"] = static_cast<double>(heapPeak.load() - baseline);
+    }
+
+    void BM_StreamingParser(benchmark::State& state)
+    {
+        const std::string response = makeResponse(static_cast<int>(state.range(0)));
+        const size_t baseline = heapInUse.load();
+        heapPeak.store(baseline);
+
+        for (auto _ : state)
+        {
+            std::list<ParamList> paramListInfo;
+            ParamListParser parser([&paramListInfo](std::string& name, std::string& value) {
+                paramListInfo.emplace_back();
+                paramListInfo.back().name = std::move(name);
+                paramListInfo.back().value = std::move(value);
+            });
+            for (size_t offset = 0; offset < response.size(); offset += curlChunkSize)
+                parser.Feed(response.data() + offset, std::min(curlChunkSize, response.size() - offset));
+
+            benchmark::DoNotOptimize(paramListInfo);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(response.size()));
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+        state.counters["peak_heap_bytes"] = static_cast<double>(heapPeak.load() - baseline);
+    }
+
+} // namespace
+
+BENCHMARK(BM_LegacyParser)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StreamingParser)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,130 @@
+/**
+ * If not stated otherwise in this file or this component's LICENSE
+ * file the following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#include "gtest/gtest.h"
+
+#include "DecoderHistory.h"
+
+using WPEFramework::Plugin::DecoderHistory;
+
+namespace {
+
+    enum { IDLE = 0, PAUSED = 1, ACTIVE = 2 };
+
+}
+
+TEST(DecoderHistoryTest, Percentiles)
+{
+    // IDLE for 50 ms before each ACTIVE stretch of 10, 20, ... 100 ms
+    DecoderHistory history(IDLE, 0);
+    uint64_t now = 0;
+    for (uint32_t stretch = 1; stretch <= 10; stretch++) {
+        now += 50;
+        history.Record(ACTIVE, now);
+        now += 10 * stretch;
+        history.Record(IDLE, now);
+    }
+    now += 50;
+
+    DecoderHistory::Statistics statistics[DecoderHistory::States];
+    uint64_t covered = 0;
+    uint32_t transitions = 0;
+    history.Get(0, now, statistics, covered, transitions);
+
+    EXPECT_EQ(covered, now);
+    EXPECT_EQ(transitions, 20u);
+
+    EXPECT_EQ(statistics[ACTIVE].episodes, 10u);
+    EXPECT_EQ(statistics[ACTIVE].time, 550u);
+    EXPECT_EQ(statistics[ACTIVE].p50, 60u);
+    EXPECT_EQ(statistics[ACTIVE].p90, 90u);
+    EXPECT_EQ(statistics[ACTIVE].p99, 100u);
+    EXPECT_EQ(statistics[ACTIVE].max, 100u);
+
+    EXPECT_EQ(statistics[IDLE].episodes, 11u);
+    EXPECT_EQ(statistics[IDLE].time, 550u);
+    EXPECT_EQ(statistics[IDLE].p50, 50u);
+    EXPECT_EQ(statistics[IDLE].max, 50u);
+
+    EXPECT_EQ(statistics[PAUSED].episodes, 0u);
+    EXPECT_EQ(statistics[PAUSED].time, 0u);
+    EXPECT_EQ(statistics[PAUSED].max, 0u);
+}
+
+TEST(DecoderHistoryTest, Window)
+{
+    DecoderHistory history(IDLE, 0);
+    history.Record(ACTIVE, 100);
+    history.Record(PAUSED, 200);
+    history.Record(IDLE, 300);
+
+    DecoderHistory::Statistics statistics[DecoderHistory::States];
+    uint64_t covered = 0;
+    uint32_t transitions = 0;
+
+    // the PAUSED stretch is cut at the start of the window
+    history.Get(150, 400, statistics, covered, transitions);
+    EXPECT_EQ(covered, 150u);
+    EXPECT_EQ(transitions, 1u);
+    EXPECT_EQ(statistics[IDLE].time, 100u);
+    EXPECT_EQ(statistics[PAUSED].time, 50u);
+    EXPECT_EQ(statistics[PAUSED].max, 50u);
+    EXPECT_EQ(statistics[ACTIVE].episodes, 0u);
+
+    // a window reaching back before recording started covers what was recorded
+    history.Get(1000, 400, statistics, covered, transitions);
+    EXPECT_EQ(covered, 400u);
+    EXPECT_EQ(transitions, 3u);
+    EXPECT_EQ(statistics[IDLE].time, 200u);
+    EXPECT_EQ(statistics[IDLE].episodes, 2u);
+}
+
+TEST(DecoderHistoryTest, WrapAround)
+{
+    // 10 more transitions than fit, alternating every 10 ms
+    const uint32_t recorded = DecoderHistory::Capacity + 10;
+    DecoderHistory history(IDLE, 0);
+    for (uint32_t transition = 1; transition <= recorded; transition++) {
+        history.Record(((transition % 2) != 0) ? ACTIVE : IDLE, transition * 10);
+    }
+    const uint64_t now = (recorded + 1) * 10;
+
+    DecoderHistory::Statistics statistics[DecoderHistory::States];
+    uint64_t covered = 0;
+    uint32_t transitions = 0;
+
+    // only the newest Capacity transitions are left, back to transition 11
+    history.Get(0, now, statistics, covered, transitions);
+    EXPECT_EQ(covered, now - 110);
+    EXPECT_EQ(transitions, DecoderHistory::Capacity);
+    EXPECT_EQ(statistics[IDLE].episodes, DecoderHistory::Capacity / 2);
+    EXPECT_EQ(statistics[ACTIVE].episodes, DecoderHistory::Capacity / 2);
+    EXPECT_EQ(statistics[IDLE].time + statistics[ACTIVE].time, covered);
+    EXPECT_EQ(statistics[ACTIVE].p50, 10u);
+    EXPECT_EQ(statistics[ACTIVE].p99, 10u);
+    EXPECT_EQ(statistics[ACTIVE].max, 10u);
+
+    // the newest entries sit either side of the wrap point
+    history.Get(25, now, statistics, covered, transitions);
+    EXPECT_EQ(covered, 25u);
+    EXPECT_EQ(transitions, 2u);
+    EXPECT_EQ(statistics[IDLE].time, 15u);
+    EXPECT_EQ(statistics[IDLE].episodes, 2u);
+    EXPECT_EQ(statistics[ACTIVE].time, 10u);
+}
@@ -0,0 +1,127 @@
+/**
+ * If not stated otherwise in this file or this component's LICENSE
+ * file the following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+#include "DeliveryQueue.h"
+
+using WPEFramework::Plugin::DeliveryQueue;
+
+namespace {
+
+    // an event supersedes a queued one with the same key
+    struct Event {
+        std::string key;
+        uint32_t value;
+    };
+
+    typedef DeliveryQueue<Event> Queue;
+
+    bool sameKey(const Event& queued, const Event& incoming)
+    {
+        return (queued.key == incoming.key);
+    }
+
+    std::string drain(Queue& queue)
+    {
+        std::string events;
+        Event event;
+        uint64_t queued;
+        while (queue.Pop(event, queued) == true) {
+            events += event.key + std::to_string(event.value) + " ";
+        }
+        return events;
+    }
+
+}
+
+TEST(DeliveryQueueTest, DropOldest)
+{
+    Queue queue(2, Queue::DROP_OLDEST, sameKey);
+
+    EXPECT_EQ(queue.Push({ "a", 1 }, 10), Queue::START);
+    EXPECT_EQ(queue.Push({ "b", 1 }, 20), Queue::QUEUED);
+    EXPECT_EQ(queue.Push({ "a", 2 }, 30), Queue::QUEUED);
+    EXPECT_EQ(queue.Get().dropped, 1u);
+    EXPECT_EQ(queue.Get().coalesced, 0u);
+    EXPECT_EQ(queue.Get().queued, 2u);
+    EXPECT_EQ(queue.Get().maxQueued, 2u);
+
+    EXPECT_EQ(drain(queue), "b1 a2 ");
+    // the drain has ended, the next event needs a new one
+    EXPECT_EQ(queue.Push({ "c", 1 }, 40), Queue::START);
+}
+
+TEST(DeliveryQueueTest, Coalesce)
+{
+    Queue queue(3, Queue::COALESCE, sameKey);
+
+    queue.Push({ "x", 1 }, 10);
+    queue.Push({ "y", 1 }, 20);
+    queue.Push({ "z", 1 }, 30);
+    // replaces the queued y, the others keep their place
+    EXPECT_EQ(queue.Push({ "y", 2 }, 40), Queue::QUEUED);
+    EXPECT_EQ(queue.Get().coalesced, 1u);
+    EXPECT_EQ(queue.Get().dropped, 0u);
+    // nothing to replace, the oldest goes
+    EXPECT_EQ(queue.Push({ "w", 1 }, 50), Queue::QUEUED);
+    EXPECT_EQ(queue.Get().coalesced, 1u);
+    EXPECT_EQ(queue.Get().dropped, 1u);
+
+    EXPECT_EQ(drain(queue), "z1 y2 w1 ");
+}
+
+TEST(DeliveryQueueTest, Disconnect)
+{
+    Queue queue(2, Queue::DISCONNECT, sameKey);
+
+    EXPECT_EQ(queue.Push({ "a", 1 }, 10), Queue::START);
+    EXPECT_EQ(queue.Push({ "b", 1 }, 20), Queue::QUEUED);
+    EXPECT_FALSE(queue.Closed());
+
+    // the queued events go with the one that did not fit
+    EXPECT_EQ(queue.Push({ "c", 1 }, 30), Queue::CLOSED);
+    EXPECT_TRUE(queue.Closed());
+    EXPECT_EQ(queue.Get().dropped, 3u);
+    EXPECT_EQ(queue.Get().queued, 0u);
+    EXPECT_EQ(drain(queue), "");
+    EXPECT_EQ(queue.Push({ "d", 1 }, 40), Queue::CLOSED);
+}
+
+TEST(DeliveryQueueTest, Latency)
+{
+    Queue queue(4, Queue::DROP_OLDEST, sameKey);
+    Event event;
+    uint64_t queued = 0;
+
+    queue.Push({ "a", 1 }, 100);
+    ASSERT_TRUE(queue.Pop(event, queued));
+    EXPECT_EQ(queued, 100u);
+    queue.Delivered(250 - queued);
+    queue.Push({ "b", 1 }, 300);
+    ASSERT_TRUE(queue.Pop(event, queued));
+    queue.Delivered(320 - queued);
+
+    const Queue::Statistics statistics = queue.Get();
+    EXPECT_EQ(statistics.delivered, 2u);
+    EXPECT_EQ(statistics.latency, 170u);
+    EXPECT_EQ(statistics.maxLatency, 150u);
+}
@@ -113,6 +113,19 @@ TEST_F(DeviceDiagnosticsTest, RegisterMethod)
 {
     EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getConfiguration")));
     EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getAVDecoderStatus")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getConfigurationStatistics")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getConfigurationAsync")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("queryMilestones")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("logMilestones")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getDecoderPollStatistics")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getAVDecoderStatusSnapshot")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getDecoderStates")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getDecoderHistory")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getDecoderEventStatistics")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getSubscriberStatistics")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getMetrics")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("setMethodTrace")));
+    EXPECT_EQ(Core::ERROR_NONE, handler_.Exists(_T("getMethodTrace")));
 }
 
 /**
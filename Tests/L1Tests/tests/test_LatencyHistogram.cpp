@@ -0,0 +1,79 @@
+/**
+ * If not stated otherwise in this file or this component's LICENSE
+ * file the following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#include "gtest/gtest.h"
+
+#include "LatencyHistogram.h"
+
+using WPEFramework::Plugin::LatencyHistogram;
+
+TEST(LatencyHistogramTest, Edges)
+{
+    // one bucket per value below 16
+    EXPECT_EQ(LatencyHistogram::Index(0), 0u);
+    EXPECT_EQ(LatencyHistogram::Index(15), 15u);
+    EXPECT_EQ(LatencyHistogram::Upper(15), 15u);
+    EXPECT_EQ(LatencyHistogram::Index(16), 16u);
+    EXPECT_EQ(LatencyHistogram::Upper(16), 16u);
+    EXPECT_EQ(LatencyHistogram::Index(31), 31u);
+
+    // from 32 on a bucket is 1/16th of its power of two wide
+    EXPECT_EQ(LatencyHistogram::Index(32), 32u);
+    EXPECT_EQ(LatencyHistogram::Index(33), 32u);
+    EXPECT_EQ(LatencyHistogram::Upper(32), 33u);
+    EXPECT_EQ(LatencyHistogram::Index(34), 33u);
+
+    EXPECT_EQ(LatencyHistogram::Index(UINT32_MAX), LatencyHistogram::Buckets - 1);
+    EXPECT_EQ(LatencyHistogram::Upper(LatencyHistogram::Buckets - 1), UINT32_MAX);
+    EXPECT_EQ(LatencyHistogram::Index(static_cast<uint64_t>(UINT32_MAX) + 1), LatencyHistogram::Buckets - 1);
+    EXPECT_EQ(LatencyHistogram::Index(UINT64_MAX), LatencyHistogram::Buckets - 1);
+}
+
+TEST(LatencyHistogramTest, Contiguous)
+{
+    // every bucket starts right after the previous one ends
+    for (uint32_t index = 1; index < LatencyHistogram::Buckets; index++) {
+        const uint64_t lower = static_cast<uint64_t>(LatencyHistogram::Upper(index - 1)) + 1;
+        ASSERT_EQ(LatencyHistogram::Index(lower), index) << "value " << lower;
+        ASSERT_EQ(LatencyHistogram::Index(LatencyHistogram::Upper(index)), index) << "bucket " << index;
+    }
+}
+
+TEST(LatencyHistogramTest, Summary)
+{
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 100; value++) {
+        histogram.Record(value);
+    }
+
+    LatencyHistogram::Summary summary = histogram.Get();
+    EXPECT_EQ(summary.count, 100u);
+    EXPECT_EQ(summary.sum, 5050u);
+    EXPECT_EQ(summary.max, 100u);
+    // upper ends of the buckets holding 50, 90 and 99
+    EXPECT_EQ(summary.p50, 51u);
+    EXPECT_EQ(summary.p90, 91u);
+    EXPECT_EQ(summary.p99, 99u);
+
+    histogram.Reset();
+    summary = histogram.Get();
+    EXPECT_EQ(summary.count, 0u);
+    EXPECT_EQ(summary.max, 0u);
+    EXPECT_EQ(summary.p99, 0u);
+}
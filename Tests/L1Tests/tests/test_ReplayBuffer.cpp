@@ -0,0 +1,96 @@
+/**
+ * If not stated otherwise in this file or this component's LICENSE
+ * file the following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#include "gtest/gtest.h"
+
+#include "ReplayBuffer.h"
+
+using WPEFramework::Plugin::ReplayBuffer;
+
+namespace {
+
+    struct Event {
+        uint64_t sequence;
+    };
+
+    std::vector<uint64_t> since(const ReplayBuffer<Event>& buffer, const uint64_t sequence, bool& complete)
+    {
+        std::vector<Event> events;
+        std::vector<uint64_t> sequences;
+        complete = buffer.Since(sequence, events);
+        for (const Event& event : events) {
+            sequences.push_back(event.sequence);
+        }
+        return sequences;
+    }
+
+}
+
+TEST(ReplayBufferTest, Horizon)
+{
+    ReplayBuffer<Event> buffer(3, 100);
+    bool complete = false;
+
+    // nothing emitted yet, only the starting number is known
+    EXPECT_TRUE(since(buffer, 100, complete).empty());
+    EXPECT_TRUE(complete);
+    since(buffer, 99, complete);
+    EXPECT_FALSE(complete);
+    since(buffer, 101, complete);
+    EXPECT_FALSE(complete);
+
+    buffer.Append({ 101 });
+    buffer.Append({ 102 });
+    buffer.Append({ 103 });
+    EXPECT_EQ(since(buffer, 100, complete), std::vector<uint64_t>({ 101, 102, 103 }));
+    EXPECT_TRUE(complete);
+    EXPECT_EQ(since(buffer, 102, complete), std::vector<uint64_t>({ 103 }));
+    EXPECT_TRUE(complete);
+    EXPECT_TRUE(since(buffer, 103, complete).empty());
+    EXPECT_TRUE(complete);
+    // not issued yet, e.g. from before a restart
+    EXPECT_TRUE(since(buffer, 104, complete).empty());
+    EXPECT_FALSE(complete);
+    EXPECT_EQ(buffer.Last(), 103u);
+}
+
+TEST(ReplayBufferTest, Eviction)
+{
+    ReplayBuffer<Event> buffer(3, 100);
+    bool complete = false;
+
+    for (uint64_t sequence = 101; sequence <= 104; sequence++) {
+        buffer.Append({ sequence });
+    }
+    EXPECT_EQ(buffer.Evicted(), 1u);
+
+    // 101 is gone, what is left is still handed out
+    EXPECT_EQ(since(buffer, 100, complete), std::vector<uint64_t>({ 102, 103, 104 }));
+    EXPECT_FALSE(complete);
+    EXPECT_EQ(since(buffer, 101, complete), std::vector<uint64_t>({ 102, 103, 104 }));
+    EXPECT_TRUE(complete);
+
+    // a smaller capacity moves the horizon right away
+    buffer.Configure(1);
+    EXPECT_EQ(buffer.Evicted(), 3u);
+    since(buffer, 102, complete);
+    EXPECT_FALSE(complete);
+    EXPECT_EQ(since(buffer, 103, complete), std::vector<uint64_t>({ 104 }));
+    EXPECT_TRUE(complete);
+}
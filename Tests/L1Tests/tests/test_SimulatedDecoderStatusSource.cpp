@@ -0,0 +1,154 @@
+/**
+ * If not stated otherwise in this file or this component's LICENSE
+ * file the following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+#include "SimulatedDecoderStatusSource.h"
+
+using WPEFramework::Plugin::DecoderStatusSource;
+using WPEFramework::Plugin::SimulatedDecoderStatusSource;
+
+namespace {
+
+    const char* const channelChange =
+        "# channel change\n"
+        "0    video 0 ACTIVE\n"
+        "40   audio 0 ACTIVE   # audio follows\n"
+        "500  video 0 PAUSED\n"
+        "\n"
+        "600  audio 0 IDLE\n"
+        "1000 end\n";
+
+    class SimulatedDecoderStatusSourceTest : public ::testing::Test {
+    protected:
+        uint64_t now = 1000;
+
+        bool Load(SimulatedDecoderStatusSource& source, const char* trace)
+        {
+            std::istringstream stream(trace);
+            return source.Load(stream);
+        }
+
+        int State(SimulatedDecoderStatusSource& source, const DecoderStatusSource::Type type)
+        {
+            int state = -1;
+            EXPECT_TRUE(source.DecoderState(type, 0, state));
+            return state;
+        }
+
+        SimulatedDecoderStatusSource::Clock Clock()
+        {
+            return [this]() { return now; };
+        }
+    };
+
+}
+
+TEST_F(SimulatedDecoderStatusSourceTest, Load)
+{
+    SimulatedDecoderStatusSource source("", 100, 0, Clock());
+    ASSERT_TRUE(Load(source, channelChange));
+    EXPECT_EQ(source.ErrorLine(), 0u);
+
+    std::vector<DecoderStatusSource::Decoder> decoders;
+    source.Decoders(decoders);
+    ASSERT_EQ(decoders.size(), 2u);
+    EXPECT_EQ(decoders[0].type, DecoderStatusSource::VIDEO);
+    EXPECT_EQ(decoders[0].id, 0u);
+    EXPECT_EQ(decoders[1].type, DecoderStatusSource::AUDIO);
+    EXPECT_EQ(decoders[1].id, 0u);
+
+    int state = -1;
+    EXPECT_FALSE(source.DecoderState(DecoderStatusSource::VIDEO, 1, state));
+}
+
+TEST_F(SimulatedDecoderStatusSourceTest, ErrorLine)
+{
+    SimulatedDecoderStatusSource source("", 100, 0, Clock());
+
+    EXPECT_FALSE(Load(source, "0 video 0 ACTIVE\n# fine\n10 video 0 BUSY\n"));
+    EXPECT_EQ(source.ErrorLine(), 3u);
+    EXPECT_FALSE(Load(source, "\n0 tv 0 ACTIVE\n"));
+    EXPECT_EQ(source.ErrorLine(), 2u);
+    EXPECT_FALSE(Load(source, "soon video 0 ACTIVE\n"));
+    EXPECT_EQ(source.ErrorLine(), 1u);
+    EXPECT_FALSE(Load(source, "0 video 0 ACTIVE\n5 audio\n"));
+    EXPECT_EQ(source.ErrorLine(), 2u);
+    EXPECT_FALSE(Load(source, "0 # no type\n"));
+    EXPECT_EQ(source.ErrorLine(), 1u);
+
+    EXPECT_TRUE(Load(source, channelChange));
+    EXPECT_EQ(source.ErrorLine(), 0u);
+}
+
+TEST_F(SimulatedDecoderStatusSourceTest, Replay)
+{
+    SimulatedDecoderStatusSource source("", 100, 2, Clock());
+    ASSERT_TRUE(Load(source, channelChange));
+
+    // a step plays once its time is reached
+    EXPECT_EQ(source.MostActive(), DecoderStatusSource::ACTIVE);
+    EXPECT_EQ(State(source, DecoderStatusSource::AUDIO), DecoderStatusSource::IDLE);
+    now += 40;
+    EXPECT_EQ(State(source, DecoderStatusSource::AUDIO), DecoderStatusSource::ACTIVE);
+    now += 460;
+    EXPECT_EQ(State(source, DecoderStatusSource::VIDEO), DecoderStatusSource::PAUSED);
+    EXPECT_EQ(source.MostActive(), DecoderStatusSource::ACTIVE);
+    now += 100;
+    EXPECT_EQ(source.MostActive(), DecoderStatusSource::PAUSED);
+
+    // the second lap starts at the end line, states carry over
+    now += 400;
+    EXPECT_EQ(State(source, DecoderStatusSource::VIDEO), DecoderStatusSource::ACTIVE);
+    EXPECT_EQ(State(source, DecoderStatusSource::AUDIO), DecoderStatusSource::IDLE);
+
+    // after the last lap the final states stay
+    now += 5000;
+    EXPECT_EQ(State(source, DecoderStatusSource::VIDEO), DecoderStatusSource::PAUSED);
+    EXPECT_EQ(State(source, DecoderStatusSource::AUDIO), DecoderStatusSource::IDLE);
+    EXPECT_EQ(source.MostActive(), DecoderStatusSource::PAUSED);
+}
+
+TEST_F(SimulatedDecoderStatusSourceTest, SkippedLaps)
+{
+    SimulatedDecoderStatusSource source("", 100, 0, Clock());
+    ASSERT_TRUE(Load(source, channelChange));
+
+    EXPECT_EQ(source.MostActive(), DecoderStatusSource::ACTIVE);
+    // read again 550 ms into the fifth lap
+    now += 4550;
+    EXPECT_EQ(State(source, DecoderStatusSource::VIDEO), DecoderStatusSource::PAUSED);
+    EXPECT_EQ(State(source, DecoderStatusSource::AUDIO), DecoderStatusSource::ACTIVE);
+    now += 100;
+    EXPECT_EQ(source.MostActive(), DecoderStatusSource::PAUSED);
+}
+
+TEST_F(SimulatedDecoderStatusSourceTest, Speed)
+{
+    SimulatedDecoderStatusSource source("", 50, 0, Clock());
+    ASSERT_TRUE(Load(source, channelChange));
+
+    // at half speed the 500 ms step is reached after a second
+    now += 999;
+    EXPECT_EQ(State(source, DecoderStatusSource::VIDEO), DecoderStatusSource::ACTIVE);
+    now += 1;
+    EXPECT_EQ(State(source, DecoderStatusSource::VIDEO), DecoderStatusSource::PAUSED);
+}
@@ -0,0 +1,116 @@
+/**
+ * If not stated otherwise in this file or this component's LICENSE
+ * file the following copyright and licenses apply:
+ *
+ * Copyright 2025 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+#include "SubscriberFilter.h"
+
+using WPEFramework::Plugin::SubscriberFilter;
+
+namespace {
+
+    enum : uint8_t { AV_STATUS = 0x01, DECODER_STATE = 0x02 };
+    enum : uint8_t { NONE = 0x00, IDLE = 0x01, PAUSED = 0x02, ACTIVE = 0x04 };
+
+    typedef SubscriberFilter<std::string> Filter;
+
+    std::string flushed(const std::vector<std::string>& events)
+    {
+        std::string names;
+        for (const std::string& event : events) {
+            names += event + " ";
+        }
+        return names;
+    }
+
+}
+
+TEST(SubscriberFilterTest, Masks)
+{
+    bool schedule = true;
+
+    Filter open(0, 0, 0);
+    EXPECT_TRUE(open.Open());
+    EXPECT_EQ(open.Offer("a", AV_STATUS, IDLE, "", 0, schedule), Filter::PASS);
+    EXPECT_FALSE(schedule);
+
+    Filter filter(DECODER_STATE, ACTIVE, 0);
+    EXPECT_FALSE(filter.Open());
+    EXPECT_EQ(filter.Offer("a", AV_STATUS, ACTIVE, "", 0, schedule), Filter::DROP);
+    EXPECT_EQ(filter.Offer("b", DECODER_STATE, PAUSED, "", 0, schedule), Filter::DROP);
+    EXPECT_EQ(filter.Offer("c", DECODER_STATE, ACTIVE, "", 0, schedule), Filter::PASS);
+    // the status mask only applies to events reporting one
+    EXPECT_EQ(filter.Offer("d", DECODER_STATE, NONE, "", 0, schedule), Filter::PASS);
+    EXPECT_EQ(filter.Filtered(), 2u);
+}
+
+TEST(SubscriberFilterTest, Hold)
+{
+    Filter filter(0, 0, 100);
+    std::vector<std::string> events;
+    bool schedule = false;
+
+    EXPECT_EQ(filter.Offer("video0 ACTIVE", DECODER_STATE, ACTIVE, "video0", 0, schedule), Filter::PASS);
+    EXPECT_FALSE(schedule);
+    EXPECT_EQ(filter.Deadline(), 100u);
+
+    // only the first event held back asks for a flush
+    EXPECT_EQ(filter.Offer("video0 PAUSED", DECODER_STATE, PAUSED, "video0", 10, schedule), Filter::HOLD);
+    EXPECT_TRUE(schedule);
+    EXPECT_EQ(filter.Offer("video0 IDLE", DECODER_STATE, IDLE, "video0", 20, schedule), Filter::HOLD);
+    EXPECT_FALSE(schedule);
+    EXPECT_EQ(filter.Offer("audio0 ACTIVE", DECODER_STATE, ACTIVE, "audio0", 30, schedule), Filter::HOLD);
+    EXPECT_FALSE(schedule);
+    // without a key there is no state to keep
+    EXPECT_EQ(filter.Offer("milestone", 0x08, NONE, "", 40, schedule), Filter::DROP);
+    EXPECT_EQ(filter.Filtered(), 2u);
+
+    EXPECT_FALSE(filter.Flush(99, events));
+    EXPECT_TRUE(events.empty());
+    EXPECT_TRUE(filter.Flush(100, events));
+    EXPECT_EQ(flushed(events), "video0 IDLE audio0 ACTIVE ");
+    EXPECT_EQ(filter.Deadline(), 200u);
+}
+
+TEST(SubscriberFilterTest, PassDiscardsHeld)
+{
+    Filter filter(0, 0, 100);
+    std::vector<std::string> events;
+    bool schedule = false;
+
+    filter.Offer("video0 ACTIVE", DECODER_STATE, ACTIVE, "video0", 0, schedule);
+    EXPECT_EQ(filter.Offer("video0 PAUSED", DECODER_STATE, PAUSED, "video0", 50, schedule), Filter::HOLD);
+    EXPECT_TRUE(schedule);
+
+    // a newer state passing once the interval is over replaces the held one
+    EXPECT_EQ(filter.Offer("video0 IDLE", DECODER_STATE, IDLE, "video0", 100, schedule), Filter::PASS);
+    EXPECT_EQ(filter.Filtered(), 1u);
+    EXPECT_EQ(filter.Deadline(), 200u);
+
+    // the flush finds nothing and leaves the deadline
+    EXPECT_TRUE(filter.Flush(200, events));
+    EXPECT_TRUE(events.empty());
+    EXPECT_EQ(filter.Deadline(), 200u);
+
+    // and the next event held back asks for a flush again
+    EXPECT_EQ(filter.Offer("video0 ACTIVE", DECODER_STATE, ACTIVE, "video0", 150, schedule), Filter::HOLD);
+    EXPECT_TRUE(schedule);
+}
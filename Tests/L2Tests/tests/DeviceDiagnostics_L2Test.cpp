@@ -22,9 +22,12 @@
 #include <chrono>
 #include <condition_variable>
 #include <fstream>
+#include <iterator>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <interfaces/IDeviceDiagnostics.h>
+#include "interfaces/IDeviceDiagnosticsExt.h"
+#include <map>
 #include <mutex>
 #include <thread>
 
@@ -103,6 +106,117 @@ public:
     }
 };
 
+/* Notification Handler Class for the IDeviceDiagnosticsExt COM-RPC events */
+class DiagnosticsExtNotificationHandler : public Exchange::IDeviceDiagnosticsExt::INotification {
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_condition_variable;
+
+    /** @brief Received onConfigurationResult events by request id */
+    std::map<uint32_t, std::pair<bool, string>> m_results;
+
+    /** @brief Received onMilestoneLogged events */
+    std::list<string> m_milestones;
+
+    /** @brief Received onAVDecoderStatus events */
+    std::list<string> m_avStatus;
+
+    /** @brief Sequence number of the last event received */
+    uint64_t m_sequence = 0;
+
+    BEGIN_INTERFACE_MAP(Notification)
+    INTERFACE_ENTRY(Exchange::IDeviceDiagnosticsExt::INotification)
+    END_INTERFACE_MAP
+
+public:
+    DiagnosticsExtNotificationHandler() {}
+    ~DiagnosticsExtNotificationHandler() {}
+
+    void OnConfigurationResult(const uint32_t requestId, const bool success, const string& paramList, const uint64_t sequence, const uint64_t timestamp) override
+    {
+        TEST_LOG("OnConfigurationResult received: %u %d %s\n", requestId, success, paramList.c_str());
+        std::unique_lock<std::mutex> lock(m_mutex);
+        Sequenced(sequence);
+        m_results[requestId] = std::make_pair(success, paramList);
+        m_condition_variable.notify_all();
+    }
+
+    bool WaitForResult(uint32_t timeout_ms, uint32_t requestId, bool& success, string& paramList)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_condition_variable.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                [this, requestId]() { return (m_results.find(requestId) != m_results.end()); })) {
+            TEST_LOG("Timeout waiting for onConfigurationResult %u", requestId);
+            return false;
+        }
+        success = m_results[requestId].first;
+        paramList = m_results[requestId].second;
+        return true;
+    }
+
+    void OnMilestoneLogged(const string& milestones, const uint64_t sequence, const uint64_t timestamp) override
+    {
+        TEST_LOG("OnMilestoneLogged received: %s\n", milestones.c_str());
+        std::unique_lock<std::mutex> lock(m_mutex);
+        Sequenced(sequence);
+        m_milestones.push_back(milestones);
+        m_condition_variable.notify_all();
+    }
+
+    bool WaitForMilestones(uint32_t timeout_ms, size_t count, std::list<string>& milestones)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_condition_variable.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                [this, count]() { return (m_milestones.size() >= count); })) {
+            TEST_LOG("Timeout waiting for %zu onMilestoneLogged events", count);
+            return false;
+        }
+        milestones = m_milestones;
+        return true;
+    }
+
+    void OnAVDecoderStatus(const string& status, const uint64_t sequence, const uint64_t timestamp) override
+    {
+        TEST_LOG("OnAVDecoderStatus received: %s %llu\n", status.c_str(), static_cast<unsigned long long>(sequence));
+        std::unique_lock<std::mutex> lock(m_mutex);
+        Sequenced(sequence);
+        m_avStatus.push_back(status);
+        m_condition_variable.notify_all();
+    }
+
+    void OnDecoderStateChanged(const string& type, const uint32_t id, const string& status, const uint64_t sequence, const uint64_t timestamp) override
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        Sequenced(sequence);
+    }
+
+    bool WaitForAVStatus(uint32_t timeout_ms, string& status)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_condition_variable.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                [this]() { return (!m_avStatus.empty()); })) {
+            TEST_LOG("Timeout waiting for onAVDecoderStatus");
+            return false;
+        }
+        status = m_avStatus.back();
+        return true;
+    }
+
+    uint64_t Sequence()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_sequence;
+    }
+
+private:
+    /* events arrive in sequence order, called with m_mutex held */
+    void Sequenced(const uint64_t sequence)
+    {
+        EXPECT_GT(sequence, m_sequence);
+        m_sequence = sequence;
+    }
+};
+
 class DeviceDiagnostics_L2test : public L2TestMocks {
 protected:
     virtual ~DeviceDiagnostics_L2test() override;
@@ -114,6 +228,15 @@ public:
     uint32_t WaitForRequestStatus(uint32_t timeout_ms, DeviceDiagnosticsL2test_async_events_t expected_status);
     uint32_t CreateDeviceDiagnosticsInterfaceObject();
 
+    /** @brief Test configuration backend answering a single request */
+    struct OneShotServer {
+        int fd;
+        std::thread thread;
+    };
+
+    OneShotServer serveOnce(const std::string& body, const uint32_t delayMs = 0, const std::string& expectedRequest = "");
+    void stopServer(OneShotServer& server);
+
 private:
     /** @brief Mutex */
     std::mutex m_mutex;
@@ -177,6 +300,49 @@ DeviceDiagnostics_L2test::~DeviceDiagnostics_L2test()
     EXPECT_EQ(Core::ERROR_NONE, status);
 }
 
+/* Listens on the backend port, answers the first request with body after
+ * delayMs and closes the connection, so curl reads the body up to the close */
+DeviceDiagnostics_L2test::OneShotServer DeviceDiagnostics_L2test::serveOnce(const std::string& body, const uint32_t delayMs, const std::string& expectedRequest)
+{
+    OneShotServer server;
+
+    server.fd = socket(AF_INET, SOCK_STREAM, 0);
+    EXPECT_TRUE(server.fd != -1);
+
+    //for port reuse
+    int pt = 1;
+    EXPECT_FALSE(setsockopt(server.fd, SOL_SOCKET, SO_REUSEADDR, &pt, sizeof(pt)) < 0);
+
+    sockaddr_in sockaddr;
+    sockaddr.sin_family = AF_INET;
+    sockaddr.sin_addr.s_addr = INADDR_ANY;
+    sockaddr.sin_port = htons(10999);
+    EXPECT_FALSE(bind(server.fd, (struct sockaddr*)&sockaddr, sizeof(sockaddr)) < 0);
+    EXPECT_FALSE(listen(server.fd, 10) < 0);
+
+    const int fd = server.fd;
+    server.thread = std::thread([fd, body, delayMs, expectedRequest]() {
+        const int connection = accept(fd, nullptr, nullptr);
+        ASSERT_FALSE(connection < 0);
+        char buffer[2048] = { 0 };
+        ASSERT_TRUE(read(connection, buffer, 2048) > 0);
+        if (expectedRequest.empty() == false) {
+            EXPECT_EQ(string(buffer), expectedRequest);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+        std::string response = _T("HTTP/1.1 200\n\rContent-type: application/json\n\r") + body;
+        send(connection, response.c_str(), response.size(), 0);
+        close(connection);
+    });
+    return server;
+}
+
+void DeviceDiagnostics_L2test::stopServer(OneShotServer& server)
+{
+    server.thread.join();
+    close(server.fd);
+}
+
 void DeviceDiagnostics_L2test::onAVDecoderStatusChanged(const JsonObject& message)
 {
     TEST_LOG("onAVDecoderStatusChanged event triggered ***\n");
@@ -246,6 +412,28 @@ MATCHER_P(MatchRequestStatus, data, "")
     return match;
 }
 
+/* Milestones are written by the plugin's writer thread, so wait for the
+ * expected last line to show up. Returns the last line seen. */
+static std::string waitForLastMilestone(const std::string& expected, uint32_t timeout_ms)
+{
+    std::string lastLine;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    do {
+        std::ifstream verifyFile("/opt/logs/rdk_milestones.log");
+        std::string line;
+        while (std::getline(verifyFile, line)) {
+            if (!line.empty()) {
+                lastLine = line;
+            }
+        }
+        if (lastLine == expected) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    } while (std::chrono::steady_clock::now() < deadline);
+    return lastLine;
+}
+
 /************Test case Details **************************
 ** 1.LogMilestone with no marker string.
 ** 2.LogMilestone with test marker string.
@@ -297,17 +485,7 @@ TEST_F(DeviceDiagnostics_L2test, LogMilestone_JSONRPC)
     EXPECT_EQ(Core::ERROR_NONE, status);
 
     // check if the marker was inserted in the milestone file
-    std::ifstream verifyFile("/opt/logs/rdk_milestones.log");
-    ASSERT_TRUE(verifyFile.is_open()) << "Failed to open milestone log.";
-    std::string line;
-    std::string lastLine;
-    while (std::getline(verifyFile, line)) {
-        if (!line.empty()) {
-            lastLine = line;
-        }
-    }
-    verifyFile.close();
-    EXPECT_EQ(lastLine, params["marker"].String().c_str());
+    EXPECT_EQ(waitForLastMilestone(params["marker"].String(), 2000), params["marker"].String().c_str());
 
     delete p_rdkloggerImplMock;
     RdkLoggerMilestone::getInstance().impl = nullptr;
@@ -363,15 +541,16 @@ TEST_F(DeviceDiagnostics_L2test, ACTIVE_GetAVDecoderStatus_JSONRPC)
     EXPECT_CALL(async_handler, onAVDecoderStatusChanged(MatchRequestStatus(expected_status)))
     .WillRepeatedly(Invoke(this, &DeviceDiagnostics_L2test::onAVDecoderStatusChanged));
 
+    // the status is published by the poll before the event goes out
+    signalled = WaitForRequestStatus(AV_POLL_TIMEOUT, DeviceDiagnostics_onAVDecoderStatusChanged);
+    EXPECT_TRUE(signalled & DeviceDiagnostics_onAVDecoderStatusChanged);
+
     JsonObject param, result;
     param["avDecoderStatus"] = "";
     status = InvokeServiceMethod("org.rdk.DeviceDiagnostics.1", "getAVDecoderStatus", param, result);
     EXPECT_EQ(Core::ERROR_NONE, status);
     EXPECT_EQ(result["avDecoderStatus"].String(), "ACTIVE");
 
-    signalled = WaitForRequestStatus(AV_POLL_TIMEOUT, DeviceDiagnostics_onAVDecoderStatusChanged);
-    EXPECT_TRUE(signalled & DeviceDiagnostics_onAVDecoderStatusChanged);
-
     /*Unregister for event*/
     jsonrpc.Unsubscribe(AV_POLL_TIMEOUT, _T("onAVDecoderStatusChanged"));
 }
@@ -408,6 +587,36 @@ TEST_F(DeviceDiagnostics_L2test, GetConfiguration_JSONRPC)
     EXPECT_FALSE(result["success"].Boolean());
 }
 
+/************Test case Details **************************
+** 1.GetConfigurationStatistics using Jsonrpc.
+** 2.Validate a failed backend request is counted without reuse.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetConfigurationStatistics_JSONRPC)
+{
+    JSONRPC::LinkType<Core::JSON::IElement> jsonrpc(DEVDIAG_CALLSIGN, DEVDIAGL2TEST_CALLSIGN);
+    uint32_t status = Core::ERROR_GENERAL;
+    JsonObject params, result;
+
+    status = InvokeServiceMethod("org.rdk.DeviceDiagnostics.1", "getConfigurationStatistics", params, result);
+    EXPECT_EQ(Core::ERROR_NONE, status);
+    uint32_t requests = result["requests"].Number();
+    uint32_t reused = result["reusedConnections"].Number();
+
+    // backend is not running, request fails
+    JsonArray names;
+    names.Add("Device.X_CISCO_COM_LED.RedPwm");
+    params["names"] = names;
+    status = InvokeServiceMethod("org.rdk.DeviceDiagnostics.1", "getConfiguration", params, result);
+    EXPECT_EQ(Core::ERROR_GENERAL, status);
+
+    JsonObject empty;
+    status = InvokeServiceMethod("org.rdk.DeviceDiagnostics.1", "getConfigurationStatistics", empty, result);
+    EXPECT_EQ(Core::ERROR_NONE, status);
+    EXPECT_EQ(requests + 1, result["requests"].Number());
+    EXPECT_EQ(reused, result["reusedConnections"].Number());
+}
+
 /************Test case Details **************************
 ** 1.LogMilestone with no marker string.
 ** 2.LogMilestone with test marker string.
@@ -457,18 +666,7 @@ TEST_F(DeviceDiagnostics_L2test, LogMilestone_COMRPC)
     marker = "2024-01-10 10:15:40 [INFO] Test Marker.";
     status = m_devdiagplugin->LogMilestone(marker, success);
     EXPECT_TRUE(success);
-    std::ifstream verifyFile("/opt/logs/rdk_milestones.log");
-    ASSERT_TRUE(verifyFile.is_open()) << "Failed to open milestone log.";
-    std::string line;
-    std::string lastLine;
-    while (std::getline(verifyFile, line)) {
-        if (!line.empty()) {
-            lastLine = line;
-        }
-    }
-    verifyFile.close();
-
-    EXPECT_EQ(lastLine, marker);
+    EXPECT_EQ(waitForLastMilestone(marker, 2000), marker);
     EXPECT_EQ(status, Core::ERROR_NONE);
     if (status != Core::ERROR_NONE) {
         std::string errorMsg = "COM-RPC returned error " + std::to_string(status) + " (" + std::string(Core::ErrorToString(status)) + ")";
@@ -478,6 +676,340 @@ TEST_F(DeviceDiagnostics_L2test, LogMilestone_COMRPC)
     RdkLoggerMilestone::getInstance().impl = nullptr;
 }
 
+/************Test case Details **************************
+** 1.LogMilestones with an empty marker in the list fails and logs nothing.
+** 2.LogMilestones with several markers writes all of them in order.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, LogMilestones_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    {
+        std::ofstream milestoneFile("/opt/logs/rdk_milestones.log", std::ios_base::trunc);
+        milestoneFile << "2024-01-10 10:15:23 [INFO] System boot initiated\n";
+    }
+
+    RdkLoggerMilestone::getInstance().impl = p_rdkloggerImplMock;
+    ON_CALL(*p_rdkloggerImplMock, logMilestone(::testing::_))
+        .WillByDefault([](const char* tag) {
+            std::ofstream milestoneFile("/opt/logs/rdk_milestones.log", std::ios_base::app);
+            if (milestoneFile.is_open()) {
+                milestoneFile << tag << "\n";
+            }
+        });
+
+    bool success = true;
+    std::list<string> invalid = { "BULK_MARKER_INVALID", "" };
+    WPEFramework::RPC::IStringIterator* markers = Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(invalid);
+    EXPECT_EQ(devdiagext->LogMilestones(markers, success), Core::ERROR_GENERAL);
+    EXPECT_FALSE(success);
+    markers->Release();
+
+    std::list<string> valid = { "BULK_MARKER_ONE", "BULK_MARKER_TWO", "BULK_MARKER_THREE" };
+    markers = Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(valid);
+    EXPECT_EQ(devdiagext->LogMilestones(markers, success), Core::ERROR_NONE);
+    EXPECT_TRUE(success);
+    markers->Release();
+
+    EXPECT_EQ(waitForLastMilestone("BULK_MARKER_THREE", 2000), "BULK_MARKER_THREE");
+
+    std::list<string> lines;
+    std::ifstream verifyFile("/opt/logs/rdk_milestones.log");
+    std::string line;
+    while (std::getline(verifyFile, line)) {
+        lines.push_back(line);
+    }
+    EXPECT_EQ(lines, std::list<string>({ "2024-01-10 10:15:23 [INFO] System boot initiated",
+        "BULK_MARKER_ONE", "BULK_MARKER_TWO", "BULK_MARKER_THREE" }));
+
+    delete p_rdkloggerImplMock;
+    RdkLoggerMilestone::getInstance().impl = nullptr;
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetDecoderPollStatistics returns one entry per decoder status, in IDLE, PAUSED, ACTIVE order.
+** 2.The current poll interval lies within the configured bounds.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetDecoderPollStatistics_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    Exchange::IDeviceDiagnosticsExt::IDecoderPollModeIterator* modes = nullptr;
+    uint32_t interval = 0;
+    EXPECT_EQ(devdiagext->GetDecoderPollStatistics(modes, interval), Core::ERROR_NONE);
+    ASSERT_TRUE(modes != nullptr);
+
+    std::list<string> names;
+    Exchange::IDeviceDiagnosticsExt::DecoderPollMode mode;
+    while (modes->Next(mode) == true) {
+        TEST_LOG("%s: wakeups %u (%u/h), transitions %u, latency avg %u max %u ms", mode.mode.c_str(), mode.wakeups,
+            mode.wakeupsPerHour, mode.transitions, mode.averageLatencyMs, mode.maxLatencyMs);
+        EXPECT_LE(mode.averageLatencyMs, mode.maxLatencyMs);
+        names.push_back(mode.mode);
+    }
+    modes->Release();
+
+    EXPECT_EQ(names, std::list<string>({ "IDLE", "PAUSED", "ACTIVE" }));
+    EXPECT_GE(interval, 1000u);
+    EXPECT_LE(interval, 5000u);
+
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetAVDecoderStatusSnapshot returns the published status with its read time.
+** 2.GetAVDecoderStatusSnapshot with fresh reads ERM now, so the time does not go back.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetAVDecoderStatusSnapshot_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    Exchange::IDeviceDiagnosticsExt::AVDecoderStatusSnapshot cached;
+    EXPECT_EQ(devdiagext->GetAVDecoderStatusSnapshot(false, cached), Core::ERROR_NONE);
+    EXPECT_EQ(cached.avDecoderStatus, "IDLE");
+    EXPECT_GT(cached.timestamp, 0u);
+
+    Exchange::IDeviceDiagnosticsExt::AVDecoderStatusSnapshot fresh;
+    EXPECT_EQ(devdiagext->GetAVDecoderStatusSnapshot(true, fresh), Core::ERROR_NONE);
+    EXPECT_EQ(fresh.avDecoderStatus, "IDLE");
+    EXPECT_GE(fresh.timestamp, cached.timestamp);
+
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetDecoderStates lists every decoder as video or audio with a known status.
+** 2.Video decoders come first and ids count up within a type.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetDecoderStates_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    Exchange::IDeviceDiagnosticsExt::IDecoderStateIterator* decoders = nullptr;
+    EXPECT_EQ(devdiagext->GetDecoderStates(decoders), Core::ERROR_NONE);
+    ASSERT_TRUE(decoders != nullptr);
+
+    std::map<string, uint32_t> nextId;
+    bool audioSeen = false;
+    Exchange::IDeviceDiagnosticsExt::DecoderState decoder;
+    while (decoders->Next(decoder) == true) {
+        TEST_LOG("%s decoder %u: %s since %llu", decoder.type.c_str(), decoder.id, decoder.status.c_str(),
+            static_cast<unsigned long long>(decoder.lastTransition));
+        EXPECT_TRUE((decoder.type == "video") || (decoder.type == "audio"));
+        EXPECT_TRUE((decoder.status == "IDLE") || (decoder.status == "PAUSED") || (decoder.status == "ACTIVE"));
+        EXPECT_FALSE(audioSeen && (decoder.type == "video"));
+        audioSeen = audioSeen || (decoder.type == "audio");
+        EXPECT_EQ(decoder.id, nextId[decoder.type]++);
+    }
+    decoders->Release();
+
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetDecoderHistory over all history returns IDLE, PAUSED and ACTIVE statistics.
+** 2.The time in each state adds up to the covered window and duty cycles to 100%.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetDecoderHistory_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    Exchange::IDeviceDiagnosticsExt::IDecoderStateHistoryIterator* states = nullptr;
+    uint64_t coveredMs = 0;
+    uint32_t transitions = 0;
+    EXPECT_EQ(devdiagext->GetDecoderHistory(0, states, coveredMs, transitions), Core::ERROR_NONE);
+    ASSERT_TRUE(states != nullptr);
+
+    std::list<string> names;
+    uint64_t total = 0;
+    uint32_t dutyCycle = 0;
+    Exchange::IDeviceDiagnosticsExt::DecoderStateHistory state;
+    while (states->Next(state) == true) {
+        TEST_LOG("%s: %llu ms (%u), %u episodes, p50 %u p90 %u p99 %u max %u ms", state.status.c_str(),
+            static_cast<unsigned long long>(state.timeMs), state.dutyCycle, state.episodes, state.p50Ms, state.p90Ms, state.p99Ms, state.maxMs);
+        EXPECT_LE(state.p50Ms, state.p90Ms);
+        EXPECT_LE(state.p90Ms, state.p99Ms);
+        EXPECT_LE(state.p99Ms, state.maxMs);
+        names.push_back(state.status);
+        total += state.timeMs;
+        dutyCycle += state.dutyCycle;
+    }
+    states->Release();
+
+    EXPECT_EQ(names, std::list<string>({ "IDLE", "PAUSED", "ACTIVE" }));
+    EXPECT_EQ(total, coveredMs);
+    if (coveredMs > 0) {
+        EXPECT_GE(dutyCycle, 9997u);
+        EXPECT_LE(dutyCycle, 10000u);
+    }
+
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetDecoderEventStatistics succeeds.
+** 2.With the default debounce window of 0 every status change is sent, none is suppressed.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetDecoderEventStatistics_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    uint32_t sent = 0;
+    uint32_t suppressed = 0;
+    EXPECT_EQ(devdiagext->GetDecoderEventStatistics(sent, suppressed), Core::ERROR_NONE);
+    TEST_LOG("decoder status events sent %u, suppressed %u", sent, suppressed);
+    EXPECT_EQ(suppressed, 0u);
+
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetSubscriberStatistics using Comrpc.
+** 2.Every registered notification has its own queue, none has dropped events.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetSubscriberStatistics_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    Exchange::IDeviceDiagnosticsExt::ISubscriberStatisticsIterator* subscribers = nullptr;
+    uint32_t disconnected = 0;
+    EXPECT_EQ(devdiagext->GetSubscriberStatistics(subscribers, disconnected), Core::ERROR_NONE);
+    ASSERT_TRUE(subscribers != nullptr);
+
+    Exchange::IDeviceDiagnosticsExt::SubscriberStatistics subscriber;
+    uint32_t count = 0;
+    while (subscribers->Next(subscriber) == true) {
+        TEST_LOG("subscriber %u %s queued %u delivered %u latency %u/%u us", subscriber.id, subscriber.interface.c_str(),
+            subscriber.queued, subscriber.delivered, subscriber.averageLatencyUs, subscriber.maxLatencyUs);
+        EXPECT_EQ(subscriber.dropped, 0u);
+        EXPECT_LE(subscriber.averageLatencyUs, subscriber.maxLatencyUs);
+        count++;
+    }
+    subscribers->Release();
+
+    EXPECT_GE(count, 1u);
+    EXPECT_EQ(disconnected, 0u);
+
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetMetrics counts GetAVDecoderStatus calls using Comrpc.
+** 2.GetMetrics with reset starts counting afresh.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetMetrics_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    Exchange::IDeviceDiagnosticsExt::IMethodMetricsIterator* methods = nullptr;
+    Exchange::IDeviceDiagnosticsExt::MethodMetrics method;
+    EXPECT_EQ(devdiagext->GetMetrics(true, methods), Core::ERROR_NONE);
+    ASSERT_TRUE(methods != nullptr);
+    methods->Release();
+
+    Exchange::IDeviceDiagnostics::AvDecoderStatusResult result;
+    for (int call = 0; call < 3; call++) {
+        EXPECT_EQ(m_devdiagplugin->GetAVDecoderStatus(result), Core::ERROR_NONE);
+    }
+
+    methods = nullptr;
+    EXPECT_EQ(devdiagext->GetMetrics(true, methods), Core::ERROR_NONE);
+    ASSERT_TRUE(methods != nullptr);
+    bool found = false;
+    while (methods->Next(method) == true) {
+        TEST_LOG("%s calls %u errors %u p50 %u p99 %u max %u us", method.method.c_str(), method.calls, method.errors, method.p50Us, method.p99Us, method.maxUs);
+        if (method.method == "getAVDecoderStatus") {
+            found = true;
+            EXPECT_EQ(method.calls, 3u);
+            EXPECT_EQ(method.errors, 0u);
+            EXPECT_LE(method.p50Us, method.p99Us);
+            EXPECT_LE(method.p99Us, method.maxUs);
+        }
+    }
+    methods->Release();
+    EXPECT_TRUE(found);
+
+    methods = nullptr;
+    EXPECT_EQ(devdiagext->GetMetrics(false, methods), Core::ERROR_NONE);
+    ASSERT_TRUE(methods != nullptr);
+    while (methods->Next(method) == true) {
+        if (method.method == "getAVDecoderStatus") {
+            EXPECT_EQ(method.calls, 0u);
+        }
+    }
+    methods->Release();
+
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.SetMethodTrace turns tracing on for one method using Comrpc.
+** 2.GetMethodTrace lists it once, whatever the case it was given in.
+** 3.SetMethodTrace turns it off again.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, SetMethodTrace_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    EXPECT_EQ(devdiagext->SetMethodTrace("", true), Core::ERROR_GENERAL);
+    EXPECT_EQ(devdiagext->SetMethodTrace("getAVDecoderStatus", true), Core::ERROR_NONE);
+    EXPECT_EQ(devdiagext->SetMethodTrace("GetAVDecoderStatus", true), Core::ERROR_NONE);
+
+    Exchange::IDeviceDiagnostics::AvDecoderStatusResult result;
+    EXPECT_EQ(m_devdiagplugin->GetAVDecoderStatus(result), Core::ERROR_NONE);
+
+    RPC::IStringIterator* methods = nullptr;
+    string method;
+    uint32_t count = 0;
+    EXPECT_EQ(devdiagext->GetMethodTrace(methods), Core::ERROR_NONE);
+    ASSERT_TRUE(methods != nullptr);
+    while (methods->Next(method) == true) {
+        TEST_LOG("traced: %s", method.c_str());
+        EXPECT_EQ(method, "getAVDecoderStatus");
+        count++;
+    }
+    methods->Release();
+    EXPECT_EQ(count, 1u);
+
+    EXPECT_EQ(devdiagext->SetMethodTrace("getavdecoderstatus", false), Core::ERROR_NONE);
+    methods = nullptr;
+    count = 0;
+    EXPECT_EQ(devdiagext->GetMethodTrace(methods), Core::ERROR_NONE);
+    ASSERT_TRUE(methods != nullptr);
+    while (methods->Next(method) == true) {
+        count++;
+    }
+    methods->Release();
+    EXPECT_EQ(count, 0u);
+
+    devdiagext->Release();
+}
+
 /************Test case Details **************************
 ** 1.GetAVDecoderStatus with IDLE status using Comrpc.
 *******************************************************/
@@ -592,31 +1124,8 @@ TEST_F(DeviceDiagnostics_L2test, GetConfiguration_COMRPC)
     }
 
     // server snippet
-    int sockfd = socket(AF_INET, SOCK_STREAM, 0);
-    ASSERT_TRUE(sockfd != -1);
-
-    //for port reuse
-    int pt = 1;
-    ASSERT_FALSE(setsockopt(sockfd, SOL_SOCKET, SO_REUSEADDR, &pt, sizeof(pt)) < 0);
-
-    sockaddr_in sockaddr;
-    sockaddr.sin_family = AF_INET;
-    sockaddr.sin_addr.s_addr = INADDR_ANY;
-    sockaddr.sin_port = htons(10999);
-    ASSERT_FALSE(bind(sockfd, (struct sockaddr*)&sockaddr, sizeof(sockaddr)) < 0);
-    ASSERT_FALSE(listen(sockfd, 10) < 0);
-
-    std::thread thread = std::thread([&]() {
-        auto addrlen = sizeof(sockaddr);
-        const int connection = accept(sockfd, (struct sockaddr*)&sockaddr, (socklen_t*)&addrlen);
-        ASSERT_FALSE(connection < 0);
-        char buffer[2048] = { 0 };
-        ASSERT_TRUE(read(connection, buffer, 2048) > 0);
-        EXPECT_EQ(string(buffer), string(_T("POST / HTTP/1.1\r\nHost: 127.0.0.1:10999\r\nAccept: */*\r\nContent-Length: 98\r\nContent-Type: application/x-www-form-urlencoded\r\n\r\n{\"paramList\":[{\"name\":\"Device.X_CISCO_COM_LED.RedPwm\"},{\"name\":\"Device.DeviceInfo.Manufacturer\"}]}")));
-        std::string response = _T("HTTP/1.1 200\n\rContent-type: application/json\n\r{\"paramList\":[{\"name\":\"Device.X_CISCO_COM_LED.RedPwm\",\"value\":\"123\"},{\"name\":\"Device.DeviceInfo.Manufacturer\",\"value\":\"RDK\"}],\"success\":true}");
-        send(connection, response.c_str(), response.size(), 0);
-        close(connection);
-    });
+    OneShotServer server = serveOnce(_T("{\"paramList\":[{\"name\":\"Device.X_CISCO_COM_LED.RedPwm\",\"value\":\"123\"},{\"name\":\"Device.DeviceInfo.Manufacturer\",\"value\":\"RDK\"}],\"success\":true}"), 0,
+        _T("POST / HTTP/1.1\r\nHost: 127.0.0.1:10999\r\nAccept: */*\r\nContent-Length: 98\r\nContent-Type: application/x-www-form-urlencoded\r\n\r\n{\"paramList\":[{\"name\":\"Device.X_CISCO_COM_LED.RedPwm\"},{\"name\":\"Device.DeviceInfo.Manufacturer\"}]}"));
 
     std::list<std::string> key = {
         "Device.X_CISCO_COM_LED.RedPwm",
@@ -655,8 +1164,571 @@ TEST_F(DeviceDiagnostics_L2test, GetConfiguration_COMRPC)
         paramList->Release();
         paramList = nullptr;
     }
-    thread.join();
-    close(sockfd);
+    stopServer(server);
+}
+
+/************Test case Details **************************
+** 1.GetConfiguration of an immutable parameter served by test server socket.
+** 2.Repeat the request with the server gone, value comes from the cache.
+** 3.InvalidateConfigurationCache and validate the backend is queried again.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, ConfigurationCache_COMRPC)
+{
+    uint32_t status = Core::ERROR_NONE;
+    bool success = false;
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    // serves exactly one request
+    OneShotServer server = serveOnce(_T("{\"paramList\":[{\"name\":\"Device.DeviceInfo.Manufacturer\",\"value\":\"RDK\"}],\"success\":true}"));
+
+    std::list<std::string> key = { "Device.DeviceInfo.Manufacturer" };
+    WPEFramework::RPC::IStringIterator* names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+    Exchange::IDeviceDiagnostics::IDeviceDiagnosticsParamListIterator* paramList = nullptr;
+
+    status = m_devdiagplugin->GetConfiguration(names, paramList, success);
+    EXPECT_EQ(status, Core::ERROR_NONE);
+    EXPECT_TRUE(success);
+    if (paramList) {
+        paramList->Release();
+        paramList = nullptr;
+    }
+    names->Release();
+
+    stopServer(server);
+
+    Exchange::IDeviceDiagnosticsExt::ConfigurationStatistics before;
+    EXPECT_EQ(devdiagext->GetConfigurationStatistics(before), Core::ERROR_NONE);
+
+    // backend is gone, immutable value is served from the cache
+    success = false;
+    names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+    status = m_devdiagplugin->GetConfiguration(names, paramList, success);
+    EXPECT_EQ(status, Core::ERROR_NONE);
+    EXPECT_TRUE(success);
+    std::list<std::string> values;
+    if (paramList) {
+        WPEFramework::Exchange::IDeviceDiagnostics::ParamList entry;
+        while (paramList->Next(entry)) {
+            values.push_back(entry.value);
+        }
+        paramList->Release();
+        paramList = nullptr;
+    }
+    names->Release();
+    EXPECT_EQ(values, std::list<std::string>({ "\"RDK\"" }));
+
+    Exchange::IDeviceDiagnosticsExt::ConfigurationStatistics after;
+    EXPECT_EQ(devdiagext->GetConfigurationStatistics(after), Core::ERROR_NONE);
+    EXPECT_EQ(before.cacheHits + 1, after.cacheHits);
+    EXPECT_EQ(before.requests, after.requests);
+
+    uint32_t invalidated = 0;
+    EXPECT_EQ(devdiagext->InvalidateConfigurationCache("", invalidated), Core::ERROR_NONE);
+    EXPECT_EQ(invalidated, 1u);
+
+    // cache is empty again and the backend is down
+    names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+    status = m_devdiagplugin->GetConfiguration(names, paramList, success);
+    EXPECT_EQ(status, Core::ERROR_GENERAL);
+    EXPECT_FALSE(success);
+    names->Release();
+
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetConfiguration served by test server socket with a malformed response.
+** 2.Validate the call fails although one parameter was parsed before the error.
+** 3.Repeat the request with the server gone, nothing was cached.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetConfigurationMalformed_COMRPC)
+{
+    bool success = true;
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    uint32_t invalidated = 0;
+    EXPECT_EQ(devdiagext->InvalidateConfigurationCache("", invalidated), Core::ERROR_NONE);
+
+    // serves exactly one request, the list is closed with a brace
+    OneShotServer server = serveOnce(_T("{\"paramList\":[{\"name\":\"Device.DeviceInfo.Manufacturer\",\"value\":\"RDK\"}},\"success\":true}"));
+
+    std::list<std::string> key = { "Device.DeviceInfo.Manufacturer" };
+    WPEFramework::RPC::IStringIterator* names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+    Exchange::IDeviceDiagnostics::IDeviceDiagnosticsParamListIterator* paramList = nullptr;
+    EXPECT_EQ(m_devdiagplugin->GetConfiguration(names, paramList, success), Core::ERROR_GENERAL);
+    EXPECT_FALSE(success);
+    EXPECT_TRUE(paramList == nullptr);
+    names->Release();
+
+    stopServer(server);
+
+    // the partial result was not cached, the backend is down
+    success = true;
+    names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+    EXPECT_EQ(m_devdiagplugin->GetConfiguration(names, paramList, success), Core::ERROR_GENERAL);
+    EXPECT_FALSE(success);
+    names->Release();
+
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetConfiguration served by test server socket, the connection closes mid-body.
+** 2.Validate the call fails although one parameter was complete before the cut.
+** 3.Repeat the request with the server gone, nothing was cached.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetConfigurationTruncated_COMRPC)
+{
+    bool success = true;
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    uint32_t invalidated = 0;
+    EXPECT_EQ(devdiagext->InvalidateConfigurationCache("", invalidated), Core::ERROR_NONE);
+
+    // serves exactly one request, the list and the object are never closed
+    OneShotServer server = serveOnce(_T("{\"paramList\":[{\"name\":\"Device.DeviceInfo.Manufacturer\",\"value\":\"RDK\"}"));
+
+    std::list<std::string> key = { "Device.DeviceInfo.Manufacturer" };
+    WPEFramework::RPC::IStringIterator* names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+    Exchange::IDeviceDiagnostics::IDeviceDiagnosticsParamListIterator* paramList = nullptr;
+    EXPECT_EQ(m_devdiagplugin->GetConfiguration(names, paramList, success), Core::ERROR_GENERAL);
+    EXPECT_FALSE(success);
+    EXPECT_TRUE(paramList == nullptr);
+    names->Release();
+
+    stopServer(server);
+
+    // the partial result was not cached, the backend is down
+    success = true;
+    names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+    EXPECT_EQ(m_devdiagplugin->GetConfiguration(names, paramList, success), Core::ERROR_GENERAL);
+    EXPECT_FALSE(success);
+    names->Release();
+
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.Two concurrent GetConfiguration calls for the same names in a different order.
+** 2.Test server answers a single request, slowly.
+** 3.Validate both calls succeed on one backend round-trip and the coalesced counter.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, ConfigurationCoalescing_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    uint32_t invalidated = 0;
+    EXPECT_EQ(devdiagext->InvalidateConfigurationCache("", invalidated), Core::ERROR_NONE);
+
+    Exchange::IDeviceDiagnosticsExt::ConfigurationStatistics before;
+    EXPECT_EQ(devdiagext->GetConfigurationStatistics(before), Core::ERROR_NONE);
+
+    // serves exactly one request, and takes its time doing so
+    OneShotServer server = serveOnce(_T("{\"paramList\":[{\"name\":\"Device.X_CISCO_COM_LED.RedPwm\",\"value\":\"123\"},{\"name\":\"Device.X_CISCO_COM_LED.GreenPwm\",\"value\":\"45\"}],\"success\":true}"), 1000);
+
+    auto request = [this](const std::list<std::string>& key, std::list<std::string>& values) {
+        bool success = false;
+        Exchange::IDeviceDiagnostics::IDeviceDiagnosticsParamListIterator* paramList = nullptr;
+        WPEFramework::RPC::IStringIterator* names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+        EXPECT_EQ(m_devdiagplugin->GetConfiguration(names, paramList, success), Core::ERROR_NONE);
+        EXPECT_TRUE(success);
+        if (paramList) {
+            WPEFramework::Exchange::IDeviceDiagnostics::ParamList entry;
+            while (paramList->Next(entry)) {
+                values.push_back(entry.value);
+            }
+            paramList->Release();
+        }
+        names->Release();
+    };
+
+    std::list<std::string> first, second;
+    std::thread leader = std::thread([&]() {
+        request({ "Device.X_CISCO_COM_LED.RedPwm", "Device.X_CISCO_COM_LED.GreenPwm" }, first);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    request({ "Device.X_CISCO_COM_LED.GreenPwm", "Device.X_CISCO_COM_LED.RedPwm", "Device.X_CISCO_COM_LED.GreenPwm" }, second);
+    leader.join();
+
+    // each caller gets the shared values in its own request order
+    EXPECT_EQ(first, std::list<std::string>({ "\"123\"", "\"45\"" }));
+    EXPECT_EQ(second, std::list<std::string>({ "\"45\"", "\"123\"", "\"45\"" }));
+
+    stopServer(server);
+
+    Exchange::IDeviceDiagnosticsExt::ConfigurationStatistics after;
+    EXPECT_EQ(devdiagext->GetConfigurationStatistics(after), Core::ERROR_NONE);
+    EXPECT_EQ(before.requests + 1, after.requests);
+    EXPECT_EQ(before.coalescedCalls + 1, after.coalescedCalls);
+
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetConfigurationAsync served by test server socket, result arrives in onConfigurationResult.
+** 2.GetConfigurationAsync with the backend down, onConfigurationResult reports failure.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetConfigurationAsync_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    Core::Sink<DiagnosticsExtNotificationHandler> extnotify;
+    EXPECT_EQ(devdiagext->Register(&extnotify), Core::ERROR_NONE);
+
+    uint32_t invalidated = 0;
+    EXPECT_EQ(devdiagext->InvalidateConfigurationCache("", invalidated), Core::ERROR_NONE);
+
+    OneShotServer server = serveOnce(_T("{\"paramList\":[{\"name\":\"Device.X_CISCO_COM_LED.RedPwm\",\"value\":\"123\"}],\"success\":true}"));
+
+    std::list<std::string> key = { "Device.X_CISCO_COM_LED.RedPwm" };
+    WPEFramework::RPC::IStringIterator* names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+    uint32_t requestId = 0;
+    EXPECT_EQ(devdiagext->GetConfigurationAsync(names, requestId), Core::ERROR_NONE);
+    names->Release();
+
+    bool success = false;
+    string paramList;
+    EXPECT_TRUE(extnotify.WaitForResult(5000, requestId, success, paramList));
+    EXPECT_TRUE(success);
+    JsonArray result;
+    result.FromString(paramList);
+    ASSERT_EQ(result.Length(), 1);
+    EXPECT_EQ(result[0].Object()["name"].String(), string("Device.X_CISCO_COM_LED.RedPwm"));
+    EXPECT_EQ(result[0].Object()["value"].String(), string("\"123\""));
+
+    stopServer(server);
+
+    // backend is gone, the failure is reported through the event as well
+    EXPECT_EQ(devdiagext->InvalidateConfigurationCache("", invalidated), Core::ERROR_NONE);
+    names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+    uint32_t failedId = 0;
+    EXPECT_EQ(devdiagext->GetConfigurationAsync(names, failedId), Core::ERROR_NONE);
+    names->Release();
+    EXPECT_NE(failedId, requestId);
+
+    success = true;
+    EXPECT_TRUE(extnotify.WaitForResult(5000, failedId, success, paramList));
+    EXPECT_FALSE(success);
+
+    EXPECT_EQ(devdiagext->Unregister(&extnotify), Core::ERROR_NONE);
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetConfiguration of an immutable parameter served by test server socket.
+** 2.GetConfigurationAsync of the same parameter with the server gone, result comes from the cache.
+** 3.Validate the result arrives in onConfigurationResult and the backend was not queried.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetConfigurationAsyncCached_COMRPC)
+{
+    bool success = false;
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    Core::Sink<DiagnosticsExtNotificationHandler> extnotify;
+    EXPECT_EQ(devdiagext->Register(&extnotify), Core::ERROR_NONE);
+
+    uint32_t invalidated = 0;
+    EXPECT_EQ(devdiagext->InvalidateConfigurationCache("", invalidated), Core::ERROR_NONE);
+
+    // serves exactly one request
+    OneShotServer server = serveOnce(_T("{\"paramList\":[{\"name\":\"Device.DeviceInfo.Manufacturer\",\"value\":\"RDK\"}],\"success\":true}"));
+
+    std::list<std::string> key = { "Device.DeviceInfo.Manufacturer" };
+    WPEFramework::RPC::IStringIterator* names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+    Exchange::IDeviceDiagnostics::IDeviceDiagnosticsParamListIterator* values = nullptr;
+    EXPECT_EQ(m_devdiagplugin->GetConfiguration(names, values, success), Core::ERROR_NONE);
+    EXPECT_TRUE(success);
+    if (values) {
+        values->Release();
+    }
+    names->Release();
+
+    stopServer(server);
+
+    Exchange::IDeviceDiagnosticsExt::ConfigurationStatistics before;
+    EXPECT_EQ(devdiagext->GetConfigurationStatistics(before), Core::ERROR_NONE);
+
+    // every value is cached, the result still comes through the event
+    names = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(key));
+    uint32_t requestId = 0;
+    EXPECT_EQ(devdiagext->GetConfigurationAsync(names, requestId), Core::ERROR_NONE);
+    names->Release();
+    EXPECT_NE(requestId, 0u);
+
+    success = false;
+    string paramList;
+    EXPECT_TRUE(extnotify.WaitForResult(5000, requestId, success, paramList));
+    EXPECT_TRUE(success);
+    JsonArray result;
+    result.FromString(paramList);
+    ASSERT_EQ(result.Length(), 1);
+    EXPECT_EQ(result[0].Object()["name"].String(), string("Device.DeviceInfo.Manufacturer"));
+    EXPECT_EQ(result[0].Object()["value"].String(), string("\"RDK\""));
+
+    Exchange::IDeviceDiagnosticsExt::ConfigurationStatistics after;
+    EXPECT_EQ(devdiagext->GetConfigurationStatistics(after), Core::ERROR_NONE);
+    EXPECT_EQ(before.requests, after.requests);
+    EXPECT_EQ(before.cacheHits + 1, after.cacheHits);
+
+    EXPECT_EQ(devdiagext->Unregister(&extnotify), Core::ERROR_NONE);
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.GetMilestones after appending to rdk_milestones.log returns the old and new lines in order.
+** 2.GetMilestones after rewriting rdk_milestones.log returns only the new content.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, GetMilestonesIncremental_COMRPC)
+{
+    std::string original;
+    {
+        std::ifstream saved("/opt/logs/rdk_milestones.log");
+        original.assign(std::istreambuf_iterator<char>(saved), std::istreambuf_iterator<char>());
+    }
+
+    auto milestones = [this]() {
+        std::list<std::string> lines;
+        bool success = false;
+        WPEFramework::RPC::IStringIterator* result = nullptr;
+        EXPECT_EQ(m_devdiagplugin->GetMilestones(result, success), Core::ERROR_NONE);
+        EXPECT_TRUE(success);
+        if (result != nullptr) {
+            string milestone;
+            while (result->Next(milestone) == true) {
+                lines.push_back(milestone);
+            }
+            result->Release();
+        }
+        return lines;
+    };
+
+    {
+        std::ofstream milestoneFile("/opt/logs/rdk_milestones.log");
+        milestoneFile << "MARKER_ONE\nMARKER_TWO\n";
+    }
+    EXPECT_EQ(milestones(), std::list<std::string>({ "MARKER_ONE", "MARKER_TWO" }));
+    // unchanged file
+    EXPECT_EQ(milestones(), std::list<std::string>({ "MARKER_ONE", "MARKER_TWO" }));
+
+    {
+        std::ofstream milestoneFile("/opt/logs/rdk_milestones.log", std::ios_base::app);
+        milestoneFile << "MARKER_THREE\n";
+    }
+    EXPECT_EQ(milestones(), std::list<std::string>({ "MARKER_ONE", "MARKER_TWO", "MARKER_THREE" }));
+
+    // truncated and rewritten, as done on log rotation
+    {
+        std::ofstream milestoneFile("/opt/logs/rdk_milestones.log", std::ios_base::trunc);
+        milestoneFile << "MARKER_ROTATED\n";
+    }
+    EXPECT_EQ(milestones(), std::list<std::string>({ "MARKER_ROTATED" }));
+
+    std::ofstream restore("/opt/logs/rdk_milestones.log", std::ios_base::trunc);
+    restore << original;
+}
+
+/************Test case Details **************************
+** 1.QueryMilestones with a since/until window returns only the lines inside it.
+** 2.QueryMilestones with a marker prefix or a substring filter.
+** 3.QueryMilestones with offset/limit returns one page and the total match count.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, QueryMilestones_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    std::string original;
+    {
+        std::ifstream saved("/opt/logs/rdk_milestones.log");
+        original.assign(std::istreambuf_iterator<char>(saved), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream milestoneFile("/opt/logs/rdk_milestones.log", std::ios_base::trunc);
+        milestoneFile << "2024-01-10 10:15:23 [INFO] System boot initiated\n"
+                      << "2024-01-10 10:15:25 [INFO] Core services started\n"
+                      << "2024-01-10 10:15:28 [INFO] Network connectivity established\n"
+                      << "2024-01-10 10:15:40 [INFO] System ready\n";
+    }
+
+    uint32_t total = 0;
+    auto query = [&](const uint64_t since, const uint64_t until, const string& prefix, const string& contains, const uint32_t offset, const uint32_t limit) {
+        std::list<std::string> lines;
+        WPEFramework::RPC::IStringIterator* result = nullptr;
+        EXPECT_EQ(devdiagext->QueryMilestones(since, until, prefix, contains, offset, limit, result, total), Core::ERROR_NONE);
+        if (result != nullptr) {
+            string milestone;
+            while (result->Next(milestone) == true) {
+                lines.push_back(milestone);
+            }
+            result->Release();
+        }
+        return lines;
+    };
+
+    // 2024-01-10 10:15:25 UTC .. 10:15:28 UTC
+    EXPECT_EQ(query(1704881725000ull, 1704881728000ull, "", "", 0, 0), std::list<std::string>({
+        "2024-01-10 10:15:25 [INFO] Core services started",
+        "2024-01-10 10:15:28 [INFO] Network connectivity established" }));
+    EXPECT_EQ(total, 2u);
+
+    EXPECT_EQ(query(0, 0, "System", "", 0, 0), std::list<std::string>({
+        "2024-01-10 10:15:23 [INFO] System boot initiated",
+        "2024-01-10 10:15:40 [INFO] System ready" }));
+    EXPECT_EQ(total, 2u);
+
+    EXPECT_EQ(query(0, 0, "", "connectivity", 0, 0), std::list<std::string>({
+        "2024-01-10 10:15:28 [INFO] Network connectivity established" }));
+    EXPECT_EQ(total, 1u);
+
+    EXPECT_EQ(query(0, 0, "", "", 1, 2), std::list<std::string>({
+        "2024-01-10 10:15:25 [INFO] Core services started",
+        "2024-01-10 10:15:28 [INFO] Network connectivity established" }));
+    EXPECT_EQ(total, 4u);
+
+    EXPECT_TRUE(query(0, 0, "", "", 10, 2).empty());
+    EXPECT_EQ(total, 4u);
+
+    {
+        std::ofstream restore("/opt/logs/rdk_milestones.log", std::ios_base::trunc);
+        restore << original;
+    }
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.Appending milestones to rdk_milestones.log raises one onMilestoneLogged event per new line.
+** 2.Lines already in the log are not notified.
+** All above cases using Comrpc.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, OnMilestoneLogged_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    Core::Sink<DiagnosticsExtNotificationHandler> extnotify;
+    EXPECT_EQ(devdiagext->Register(&extnotify), Core::ERROR_NONE);
+
+    {
+        std::ofstream milestoneFile("/opt/logs/rdk_milestones.log", std::ios_base::app);
+        milestoneFile << "L2_MILESTONE_ONE:1000\n";
+        milestoneFile.flush();
+        milestoneFile << "L2_MILESTONE_TWO:2000\n";
+    }
+
+    std::list<string> milestones;
+    EXPECT_TRUE(extnotify.WaitForMilestones(5000, 2, milestones));
+    EXPECT_EQ(milestones, std::list<string>({ "[\"L2_MILESTONE_ONE:1000\"]", "[\"L2_MILESTONE_TWO:2000\"]" }));
+
+    EXPECT_EQ(devdiagext->Unregister(&extnotify), Core::ERROR_NONE);
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.RegisterSince with an unknown sequence replays the latest AV decoder status and reports the gap.
+** 2.RegisterSince with the last sequence seen replays the milestone logged while not registered.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, RegisterSince_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    bool complete = true;
+    string status;
+    Core::Sink<DiagnosticsExtNotificationHandler> first;
+    EXPECT_EQ(devdiagext->RegisterSince(&first, 0, complete), Core::ERROR_NONE);
+    EXPECT_FALSE(complete);
+    EXPECT_TRUE(first.WaitForAVStatus(5000, status));
+    const uint64_t seen = first.Sequence();
+    EXPECT_EQ(devdiagext->Unregister(&first), Core::ERROR_NONE);
+
+    // a subscriber that stays registered tells when the milestone went out
+    Core::Sink<DiagnosticsExtNotificationHandler> live;
+    EXPECT_EQ(devdiagext->Register(&live), Core::ERROR_NONE);
+    {
+        std::ofstream milestoneFile("/opt/logs/rdk_milestones.log", std::ios_base::app);
+        milestoneFile << "L2_MILESTONE_REPLAYED:3000\n";
+    }
+    std::list<string> milestones;
+    EXPECT_TRUE(live.WaitForMilestones(5000, 1, milestones));
+
+    Core::Sink<DiagnosticsExtNotificationHandler> again;
+    EXPECT_EQ(devdiagext->RegisterSince(&again, seen, complete), Core::ERROR_NONE);
+    EXPECT_TRUE(complete);
+    EXPECT_TRUE(again.WaitForMilestones(5000, 1, milestones));
+    EXPECT_EQ(milestones.back(), "[\"L2_MILESTONE_REPLAYED:3000\"]");
+    EXPECT_GT(again.Sequence(), seen);
+
+    EXPECT_EQ(devdiagext->Unregister(&again), Core::ERROR_NONE);
+    EXPECT_EQ(devdiagext->Unregister(&live), Core::ERROR_NONE);
+    devdiagext->Release();
+}
+
+/************Test case Details **************************
+** 1.RegisterFiltered for AV decoder status events only.
+** 2.A logged milestone reaches an unfiltered subscriber but not the filtered one.
+*******************************************************/
+
+TEST_F(DeviceDiagnostics_L2test, RegisterFiltered_COMRPC)
+{
+    Exchange::IDeviceDiagnosticsExt* devdiagext = m_controller_devdiag->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+    ASSERT_TRUE(devdiagext != nullptr);
+
+    Exchange::IDeviceDiagnosticsExt::EventFilter filter;
+    filter.events = Exchange::IDeviceDiagnosticsExt::EVENT_AV_DECODER_STATUS;
+    filter.states = 0;
+    filter.minInterval = 0;
+
+    Core::Sink<DiagnosticsExtNotificationHandler> filtered;
+    Core::Sink<DiagnosticsExtNotificationHandler> live;
+    EXPECT_EQ(devdiagext->RegisterFiltered(&filtered, filter), Core::ERROR_NONE);
+    EXPECT_EQ(devdiagext->Register(&live), Core::ERROR_NONE);
+    {
+        std::ofstream milestoneFile("/opt/logs/rdk_milestones.log", std::ios_base::app);
+        milestoneFile << "L2_MILESTONE_FILTERED:4000\n";
+    }
+    std::list<string> milestones;
+    EXPECT_TRUE(live.WaitForMilestones(5000, 1, milestones));
+    EXPECT_FALSE(filtered.WaitForMilestones(500, 1, milestones));
+
+    Exchange::IDeviceDiagnosticsExt::ISubscriberStatisticsIterator* subscribers = nullptr;
+    uint32_t disconnected = 0;
+    EXPECT_EQ(devdiagext->GetSubscriberStatistics(subscribers, disconnected), Core::ERROR_NONE);
+    ASSERT_TRUE(subscribers != nullptr);
+    Exchange::IDeviceDiagnosticsExt::SubscriberStatistics subscriber;
+    uint32_t filteredEvents = 0;
+    while (subscribers->Next(subscriber) == true) {
+        filteredEvents += subscriber.filtered;
+    }
+    subscribers->Release();
+    EXPECT_GE(filteredEvents, 1u);
+
+    EXPECT_EQ(devdiagext->Unregister(&live), Core::ERROR_NONE);
+    EXPECT_EQ(devdiagext->Unregister(&filtered), Core::ERROR_NONE);
+    devdiagext->Release();
 }
 
 /************Test case Details **************************
@@ -86,6 +86,7 @@ echo "buliding entservices-apis"
 cd entservices-apis
 rm -rf jsonrpc/DTV.json
 patch -p1 < $GITHUB_WORKSPACE/entservices-testframework/patches/RDKEMW-1007.patch
+grep -q ID_DEVICE_DIAGNOSTICS_EXT apis/Ids.h || sed -i -f $GITHUB_WORKSPACE/plugin/interfaces/Ids.DeviceDiagnosticsExt.sed apis/Ids.h
 cd ..
 
 cmake -G Ninja -S entservices-apis  -B build/entservices-apis \
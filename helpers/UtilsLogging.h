@@ -19,11 +19,447 @@
 
 #pragma once
 
+#include <strings.h>
 #include <syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
 
-#define LOGINFO(fmt, ...) do { fprintf(stderr, "[%d] INFO [%s:%d] %s: " fmt "\n", (int)syscall(SYS_gettid), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__); fflush(stderr); } while (0)
-#define LOGWARN(fmt, ...) do { fprintf(stderr, "[%d] WARN [%s:%d] %s: " fmt "\n", (int)syscall(SYS_gettid), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__); fflush(stderr); } while (0)
-#define LOGERR(fmt, ...) do { fprintf(stderr, "[%d] ERROR [%s:%d] %s: " fmt "\n", (int)syscall(SYS_gettid), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__); fflush(stderr); } while (0)
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#define LOG_LEVEL_ERROR 0
+#define LOG_LEVEL_WARN  1
+#define LOG_LEVEL_INFO  2
+
+/* Log calls above this level are compiled out */
+#ifndef LOG_BUILD_LEVEL
+#define LOG_BUILD_LEVEL LOG_LEVEL_INFO
+#endif
+
+namespace Utils
+{
+    namespace Logging
+    {
+        /* Level below which records are dropped before anything is formatted */
+        inline std::atomic<int>& runtimeLevel()
+        {
+            static std::atomic<int> level(LOG_BUILD_LEVEL);
+            return level;
+        }
+
+        inline int Level()
+        {
+            return runtimeLevel().load(std::memory_order_relaxed);
+        }
+
+        inline void SetLevel(const int level)
+        {
+            runtimeLevel().store(level, std::memory_order_relaxed);
+        }
+
+        /* "error", "warn" or "info", -1 for anything else */
+        inline int LevelFromName(const char* name)
+        {
+            if (strcmp(name, "error") == 0)
+                return LOG_LEVEL_ERROR;
+            if (strcmp(name, "warn") == 0)
+                return LOG_LEVEL_WARN;
+            if (strcmp(name, "info") == 0)
+                return LOG_LEVEL_INFO;
+            return -1;
+        }
+
+        /* gettid is a system call, every record needs it */
+        inline int ThreadId()
+        {
+            static thread_local int id = static_cast<int>(syscall(SYS_gettid));
+            return id;
+        }
+
+        /* Records one call site may write per second, 0 for no limit */
+        inline std::atomic<uint32_t>& rateLimit()
+        {
+            static std::atomic<uint32_t> limit(20);
+            return limit;
+        }
+
+        inline void SetRateLimit(const uint32_t perSecond)
+        {
+            rateLimit().store(perSecond, std::memory_order_relaxed);
+        }
+
+        /* Rate limit state of one log statement. Past the limit records are
+         * counted instead of written, the count is handed to the first record
+         * the site writes in a later second. */
+        class Site
+        {
+            public:
+                Site()
+                    : _window(0)
+                    , _count(0)
+                    , _suppressed(0)
+                {
+                }
+
+                Site(const Site&) = delete;
+                Site& operator=(const Site&) = delete;
+
+                bool Admit(uint32_t& suppressed)
+                {
+                    const uint32_t limit = rateLimit().load(std::memory_order_relaxed);
+                    if (limit == 0)
+                        return true;
+
+                    const uint32_t now = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count());
+                    uint32_t window = _window.load(std::memory_order_relaxed);
+                    if ((window != now) && _window.compare_exchange_strong(window, now, std::memory_order_relaxed))
+                    {
+                        _count.store(0, std::memory_order_relaxed);
+                        suppressed = _suppressed.exchange(0, std::memory_order_relaxed);
+                    }
+                    if (_count.fetch_add(1, std::memory_order_relaxed) < limit)
+                        return true;
+
+                    _suppressed.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+
+            private:
+                std::atomic<uint32_t> _window;
+                std::atomic<uint32_t> _count;
+                std::atomic<uint32_t> _suppressed;
+        };
+
+        /* Records are formatted by the caller into a slot of a bounded
+         * lock-free ring and written to stderr by a background thread, a log
+         * call never waits for the console. When the ring is full the record
+         * is dropped and counted. */
+        class Writer
+        {
+            public:
+                static constexpr uint32_t Slots = 256;
+                static constexpr uint32_t RecordSize = 512;
+                static constexpr uint32_t StagingSize = 8192;
+
+                static Writer& Instance()
+                {
+                    static Writer writer;
+                    return writer;
+                }
+
+                /* Set once the writer is gone, late records go out directly */
+                static std::atomic<bool>& Closed()
+                {
+                    static std::atomic<bool> closed(false);
+                    return closed;
+                }
+
+                Writer(const Writer&) = delete;
+                Writer& operator=(const Writer&) = delete;
+
+                void Write(const char* format, va_list args)
+                {
+                    // glibc is very slow at truncating, so format in full
+                    // first and copy what fits into the slot
+                    static thread_local char staging[StagingSize];
+                    const int formatted = vsnprintf(staging, sizeof(staging), format, args);
+                    uint32_t length = (formatted > 0 ? static_cast<uint32_t>(formatted) : 0);
+                    if (length >= RecordSize)
+                    {
+                        // keep the line break of a truncated record
+                        staging[RecordSize - 2] = '\n';
+                        length = RecordSize - 1;
+                    }
+
+                    uint64_t position = _tail.load(std::memory_order_relaxed);
+                    Slot* slot;
+                    for (;;)
+                    {
+                        slot = &_slots[position % Slots];
+                        const int64_t lag = static_cast<int64_t>(slot->sequence.load(std::memory_order_acquire) - position);
+                        if (lag == 0)
+                        {
+                            if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                                break;
+                        }
+                        else if (lag < 0)
+                        {
+                            _dropped.fetch_add(1, std::memory_order_relaxed);
+                            return;
+                        }
+                        else
+                        {
+                            position = _tail.load(std::memory_order_relaxed);
+                        }
+                    }
+
+                    memcpy(slot->text, staging, length);
+                    slot->length = length;
+                    slot->sequence.store(position + 1, std::memory_order_seq_cst);
+
+                    // only the first record after the writer went idle wakes it
+                    if (_idle.exchange(false, std::memory_order_seq_cst))
+                    {
+                        {
+                            std::lock_guard<std::mutex> lock(_lock);
+                        }
+                        _signal.notify_one();
+                    }
+                }
+
+                uint64_t Dropped() const
+                {
+                    return _droppedTotal.load(std::memory_order_relaxed);
+                }
+
+            private:
+                struct Slot
+                {
+                    std::atomic<uint64_t> sequence;
+                    uint32_t length;
+                    char text[RecordSize];
+                };
+
+                Writer()
+                    : _tail(0)
+                    , _head(0)
+                    , _dropped(0)
+                    , _droppedTotal(0)
+                    , _idle(false)
+                    , _running(true)
+                    , _lock()
+                    , _signal()
+                    , _thread()
+                {
+                    for (uint32_t index = 0; index < Slots; index++)
+                    {
+                        _slots[index].sequence.store(index, std::memory_order_relaxed);
+                        _slots[index].length = 0;
+                    }
+                    _thread = std::thread(&Writer::Run, this);
+                }
+
+                ~Writer()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(_lock);
+                        _running = false;
+                    }
+                    _signal.notify_one();
+                    _thread.join();
+                    Closed().store(true);
+                    drain();
+                }
+
+                bool pending() const
+                {
+                    return (_slots[_head % Slots].sequence.load(std::memory_order_seq_cst) == (_head + 1));
+                }
+
+                void Run()
+                {
+                    std::unique_lock<std::mutex> lock(_lock);
+                    while (_running)
+                    {
+                        lock.unlock();
+                        drain();
+                        lock.lock();
+
+                        _idle.store(true, std::memory_order_seq_cst);
+                        if (_running && !pending())
+                        {
+                            _signal.wait(lock);
+                        }
+                        _idle.store(false, std::memory_order_seq_cst);
+                    }
+                }
+
+                /* Writes everything published so far, up to a batch per call */
+                void drain()
+                {
+                    iovec batch[64];
+                    uint32_t count;
+
+                    do
+                    {
+                        count = 0;
+                        while ((count < (sizeof(batch) / sizeof(batch[0]))) && pending())
+                        {
+                            Slot& slot = _slots[_head % Slots];
+                            batch[count].iov_base = slot.text;
+                            batch[count].iov_len = slot.length;
+                            count++;
+                            _head++;
+                        }
+                        if (count > 0)
+                        {
+                            if (writev(STDERR_FILENO, batch, static_cast<int>(count)) < 0)
+                            {
+                                // nowhere left to report this
+                            }
+                            for (uint64_t position = _head - count; position < _head; position++)
+                            {
+                                _slots[position % Slots].sequence.store(position + Slots, std::memory_order_release);
+                            }
+                        }
+                    } while (count == (sizeof(batch) / sizeof(batch[0])));
+
+                    const uint64_t dropped = _dropped.exchange(0, std::memory_order_relaxed);
+                    if (dropped != 0)
+                    {
+                        _droppedTotal.fetch_add(dropped, std::memory_order_relaxed);
+                        fprintf(stderr, "[%d] WARN [UtilsLogging.h] Writer: %llu log records dropped, ring full\n",
+                            ThreadId(), static_cast<unsigned long long>(dropped));
+                    }
+                }
+
+            private:
+                Slot _slots[Slots];
+                std::atomic<uint64_t> _tail;
+                uint64_t _head;
+                std::atomic<uint64_t> _dropped;
+                std::atomic<uint64_t> _droppedTotal;
+                std::atomic<bool> _idle;
+                bool _running;
+                std::mutex _lock;
+                std::condition_variable _signal;
+                std::thread _thread;
+        };
+
+        inline void Write(const char* format, ...) __attribute__((format(printf, 1, 2)));
+        inline void Write(const char* format, ...)
+        {
+            va_list args;
+            va_start(args, format);
+            if (Writer::Closed().load())
+            {
+                vfprintf(stderr, format, args);
+            }
+            else
+            {
+                Writer::Instance().Write(format, args);
+            }
+            va_end(args);
+        }
+
+        /* Methods whose requests and responses are logged by LOGTRACE. Names
+         * match without regard to case, so the JSON-RPC name selects the C++
+         * method behind it. "*" selects every method. */
+        class MethodTrace
+        {
+            public:
+                static MethodTrace& Instance()
+                {
+                    static MethodTrace trace;
+                    return trace;
+                }
+
+                MethodTrace(const MethodTrace&) = delete;
+                MethodTrace& operator=(const MethodTrace&) = delete;
+
+                bool Enabled(const char* method) const
+                {
+                    // nothing traced is the common case, keep it to one load
+                    if (_count.load(std::memory_order_relaxed) == 0)
+                        return false;
+
+                    std::lock_guard<std::mutex> lock(_lock);
+                    for (const std::string& name : _methods)
+                    {
+                        if ((name == "*") || (strcasecmp(name.c_str(), method) == 0))
+                            return true;
+                    }
+                    return false;
+                }
+
+                void Set(const std::string& method, const bool enabled)
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    std::list<std::string>::iterator index = _methods.begin();
+                    while ((index != _methods.end()) && (strcasecmp(index->c_str(), method.c_str()) != 0))
+                        ++index;
+
+                    if (enabled && (index == _methods.end()))
+                        _methods.push_back(method);
+                    else if (!enabled && (index != _methods.end()))
+                        _methods.erase(index);
+
+                    _count.store(static_cast<uint32_t>(_methods.size()), std::memory_order_relaxed);
+                }
+
+                std::list<std::string> Methods() const
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    return _methods;
+                }
+
+            private:
+                MethodTrace()
+                    : _lock()
+                    , _methods()
+                    , _count(0)
+                {
+                }
+
+            private:
+                mutable std::mutex _lock;
+                std::list<std::string> _methods;
+                std::atomic<uint32_t> _count;
+        };
+
+        inline bool Traced(const char* method)
+        {
+            return ((LOG_BUILD_LEVEL >= LOG_LEVEL_INFO) && (Level() >= LOG_LEVEL_INFO) && MethodTrace::Instance().Enabled(method));
+        }
+
+        /* Keeps the arguments of compiled out calls type checked and used */
+        inline void Discard(const char* format, ...) __attribute__((format(printf, 1, 2)));
+        inline void Discard(const char*, ...)
+        {
+        }
+    } // namespace Logging
+} // namespace Utils
+
+#define UTILS_LOG(level, tag, fmt, ...) do { \
+        if (level <= Utils::Logging::Level()) { \
+            static Utils::Logging::Site _logSite; \
+            uint32_t _logSuppressed = 0; \
+            if (_logSite.Admit(_logSuppressed)) { \
+                if (_logSuppressed != 0) \
+                    Utils::Logging::Write("[%d] " tag " [%s:%d] %s: %u similar messages suppressed\n", Utils::Logging::ThreadId(), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, _logSuppressed); \
+                Utils::Logging::Write("[%d] " tag " [%s:%d] %s: " fmt "\n", Utils::Logging::ThreadId(), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define UTILS_LOG_DISCARD(fmt, ...) do { if (false) Utils::Logging::Discard(fmt, ##__VA_ARGS__); } while (0)
+
+#if LOG_BUILD_LEVEL >= LOG_LEVEL_INFO
+#define LOGINFO(fmt, ...) UTILS_LOG(LOG_LEVEL_INFO, "INFO", fmt, ##__VA_ARGS__)
+#else
+#define LOGINFO(fmt, ...) UTILS_LOG_DISCARD(fmt, ##__VA_ARGS__)
+#endif
+#if LOG_BUILD_LEVEL >= LOG_LEVEL_WARN
+#define LOGWARN(fmt, ...) UTILS_LOG(LOG_LEVEL_WARN, "WARN", fmt, ##__VA_ARGS__)
+#else
+#define LOGWARN(fmt, ...) UTILS_LOG_DISCARD(fmt, ##__VA_ARGS__)
+#endif
+#define LOGERR(fmt, ...) UTILS_LOG(LOG_LEVEL_ERROR, "ERROR", fmt, ##__VA_ARGS__)
+
+/* LOGINFO for request and response tracing, written only while the calling
+ * method is traced. The arguments are not evaluated otherwise, so they may
+ * serialize. */
+#define LOGTRACE(fmt, ...) do { if (Utils::Logging::Traced(__FUNCTION__)) LOGINFO(fmt, ##__VA_ARGS__); } while (0)
 
 #define LOG_DEVICE_EXCEPTION0() LOGWARN("Exception caught: code=%d message=%s", err.getCode(), err.what());
 #define LOG_DEVICE_EXCEPTION1(param1) LOGWARN("Exception caught" #param1 "=%s code=%d message=%s", param1.c_str(), err.getCode(), err.what());
@@ -0,0 +1,128 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "LatencyHistogram.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Calls, failures, calls in progress and latency of one API method.
+         * A Call on the stack of the method does the bookkeeping:
+         *
+         *   CallMetrics::Call call(metrics);
+         *   ...
+         *   return call.Result(status);
+         *
+         * Everything is relaxed atomics, no lock is taken. */
+        class CallMetrics
+        {
+            public:
+                class Call
+                {
+                    public:
+                        explicit Call(CallMetrics& metrics)
+                            : _metrics(metrics)
+                            , _start(std::chrono::steady_clock::now())
+                            , _failed(false)
+                        {
+                            _metrics._inFlight.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        ~Call()
+                        {
+                            const uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::steady_clock::now() - _start).count());
+
+                            _metrics._histogram.Record(elapsed);
+                            _metrics._calls.fetch_add(1, std::memory_order_relaxed);
+                            if (_failed)
+                            {
+                                _metrics._errors.fetch_add(1, std::memory_order_relaxed);
+                            }
+                            _metrics._inFlight.fetch_sub(1, std::memory_order_relaxed);
+                        }
+
+                        Call(const Call&) = delete;
+                        Call& operator=(const Call&) = delete;
+
+                        /* Counts the call as failed unless result is 0 (ERROR_NONE) */
+                        uint32_t Result(const uint32_t result)
+                        {
+                            _failed = (result != 0);
+                            return result;
+                        }
+
+                    private:
+                        CallMetrics& _metrics;
+                        const std::chrono::steady_clock::time_point _start;
+                        bool _failed;
+                };
+
+                struct Summary
+                {
+                    uint32_t calls;
+                    uint32_t errors;
+                    uint32_t inFlight;
+                    LatencyHistogram::Summary latency;
+                };
+
+                CallMetrics()
+                    : _calls(0)
+                    , _errors(0)
+                    , _inFlight(0)
+                    , _histogram()
+                {
+                }
+                ~CallMetrics() = default;
+
+                CallMetrics(const CallMetrics&) = delete;
+                CallMetrics& operator=(const CallMetrics&) = delete;
+
+                Summary Get() const
+                {
+                    Summary summary;
+                    summary.calls = _calls.load(std::memory_order_relaxed);
+                    summary.errors = _errors.load(std::memory_order_relaxed);
+                    summary.inFlight = _inFlight.load(std::memory_order_relaxed);
+                    summary.latency = _histogram.Get();
+                    return summary;
+                }
+
+                /* Calls in progress keep being counted as such */
+                void Reset()
+                {
+                    _calls.store(0, std::memory_order_relaxed);
+                    _errors.store(0, std::memory_order_relaxed);
+                    _histogram.Reset();
+                }
+
+            private:
+                std::atomic<uint32_t> _calls;
+                std::atomic<uint32_t> _errors;
+                std::atomic<uint32_t> _inFlight;
+                LatencyHistogram _histogram;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,149 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "Module.h"
+#include "CurlHandlePool.h"
+
+#include <chrono>
+
+#include "UtilsLogging.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        CurlHandlePool::Lease::Lease(CurlHandlePool& pool)
+            : _pool(pool)
+            , _handle(pool.Acquire())
+        {
+        }
+
+        CurlHandlePool::Lease::~Lease()
+        {
+            if (_handle != nullptr)
+            {
+                _pool.Release(_handle);
+            }
+        }
+
+        CURLcode CurlHandlePool::Lease::Perform()
+        {
+            CURLcode res = curl_easy_perform(_handle);
+            _pool.Record(_handle, res);
+            return res;
+        }
+
+        CurlHandlePool::CurlHandlePool(const uint8_t size)
+            : _lock()
+            , _available()
+            , _idle()
+            , _size(size)
+            , _created(0)
+            , _statistics()
+        {
+        }
+
+        CurlHandlePool::~CurlHandlePool()
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            // Leases never outlive the pool, so every created handle is idle here
+            ASSERT(_idle.size() == _created);
+
+            for (CURL* handle : _idle)
+            {
+                curl_easy_cleanup(handle);
+            }
+            _idle.clear();
+        }
+
+        CurlHandlePool::Statistics CurlHandlePool::GetStatistics() const
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _statistics;
+        }
+
+        CURL* CurlHandlePool::Acquire()
+        {
+            CURL* handle = nullptr;
+            std::unique_lock<std::mutex> lock(_lock);
+
+            if (_idle.empty() && (_created >= _size))
+            {
+                auto start = std::chrono::steady_clock::now();
+                _available.wait(lock, [this]() { return !_idle.empty(); });
+                _statistics.waitTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+            }
+
+            if (!_idle.empty())
+            {
+                handle = _idle.front();
+                _idle.pop_front();
+            }
+            else
+            {
+                handle = curl_easy_init();
+                if (handle == nullptr)
+                {
+                    LOGERR("curl_easy_init failed");
+                    return nullptr;
+                }
+                _created++;
+            }
+            lock.unlock();
+
+            // Options are cleared when a handle goes back to the pool, only
+            // the connection cache survives between leases.
+            if (curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L) != CURLE_OK)
+                LOGWARN("Failed to set curl option: CURLOPT_TCP_KEEPALIVE");
+
+            return handle;
+        }
+
+        void CurlHandlePool::Release(CURL* handle)
+        {
+            curl_easy_reset(handle);
+
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                _idle.push_back(handle);
+            }
+            _available.notify_one();
+        }
+
+        void CurlHandlePool::Record(CURL* handle, const CURLcode result)
+        {
+            long connects = 0;
+
+            curl_easy_getinfo(handle, CURLINFO_NUM_CONNECTS, &connects);
+
+            std::lock_guard<std::mutex> lock(_lock);
+            _statistics.requests++;
+            if (connects > 0)
+            {
+                _statistics.newConnections += static_cast<uint32_t>(connects);
+            }
+            else if (result == CURLE_OK)
+            {
+                _statistics.reusedConnections++;
+            }
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,88 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <curl/curl.h>
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <condition_variable>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Fixed size set of curl easy handles shared by all GetConfiguration
+         * callers. A handle keeps its connection cache between transfers, so
+         * consecutive requests to the configuration backend reuse the same
+         * keep-alive connection instead of reconnecting every time. */
+        class CurlHandlePool
+        {
+            public:
+                struct Statistics
+                {
+                    uint32_t requests;
+                    uint32_t reusedConnections;
+                    uint32_t newConnections;
+                    uint64_t waitTimeUs;
+                };
+
+                /* Scoped ownership of one pooled handle */
+                class Lease
+                {
+                    public:
+                        explicit Lease(CurlHandlePool& pool);
+                        ~Lease();
+
+                        Lease(const Lease&) = delete;
+                        Lease& operator=(const Lease&) = delete;
+
+                        CURL* Handle() const { return _handle; }
+                        CURLcode Perform();
+
+                    private:
+                        CurlHandlePool& _pool;
+                        CURL* _handle;
+                };
+
+                explicit CurlHandlePool(const uint8_t size);
+                ~CurlHandlePool();
+
+                CurlHandlePool(const CurlHandlePool&) = delete;
+                CurlHandlePool& operator=(const CurlHandlePool&) = delete;
+
+                Statistics GetStatistics() const;
+
+            private:
+                CURL* Acquire();
+                void Release(CURL* handle);
+                void Record(CURL* handle, const CURLcode result);
+
+            private:
+                mutable std::mutex _lock;
+                std::condition_variable _available;
+                std::list<CURL*> _idle;
+                const uint8_t _size;
+                uint8_t _created;
+                Statistics _statistics;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,208 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "Module.h"
+#include "CurlMultiEngine.h"
+
+#include "UtilsLogging.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Upper bound for one curl_multi_poll, curl shortens it to its own timers */
+        static constexpr int pollTimeoutMs = 1000;
+
+        CurlMultiEngine::CurlMultiEngine(const uint32_t maxTransfers)
+            : _lock()
+            , _multi(nullptr)
+            , _thread()
+            , _running(false)
+            , _stopped(false)
+            , _maxTransfers(maxTransfers)
+            , _transfers(0)
+            , _submitted()
+            , _active()
+        {
+        }
+
+        CurlMultiEngine::~CurlMultiEngine()
+        {
+            Stop();
+        }
+
+        bool CurlMultiEngine::Submit(const uint32_t id, CURL* handle, const Completion& completion)
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+
+            if (_stopped == true)
+            {
+                lock.unlock();
+                curl_easy_cleanup(handle);
+                return false;
+            }
+
+            if (_transfers >= _maxTransfers)
+            {
+                LOGWARN("%u transfers in progress, refusing %u", _transfers, id);
+                lock.unlock();
+                curl_easy_cleanup(handle);
+                return false;
+            }
+
+            if (_multi == nullptr)
+            {
+                if ((_multi = curl_multi_init()) == nullptr)
+                {
+                    LOGERR("curl_multi_init failed");
+                    lock.unlock();
+                    curl_easy_cleanup(handle);
+                    return false;
+                }
+                _running = true;
+                _thread = std::thread(&CurlMultiEngine::Run, this);
+            }
+
+            _submitted.push_back({ id, handle, completion });
+            _transfers++;
+
+            // under the lock, Stop frees _multi once it has taken it
+            curl_multi_wakeup(_multi);
+            return true;
+        }
+
+        void CurlMultiEngine::Stop()
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+
+            if (_stopped == true)
+            {
+                return;
+            }
+            _stopped = true;
+            _running = false;
+            lock.unlock();
+
+            if (_multi != nullptr)
+            {
+                curl_multi_wakeup(_multi);
+                if (_thread.joinable())
+                {
+                    _thread.join();
+                }
+
+                std::string dropped;
+                for (auto& transfer : _active)
+                {
+                    dropped += ' ' + std::to_string(transfer.second.id);
+                    curl_multi_remove_handle(_multi, transfer.first);
+                    curl_easy_cleanup(transfer.first);
+                }
+                _active.clear();
+
+                for (auto& transfer : _submitted)
+                {
+                    dropped += ' ' + std::to_string(transfer.id);
+                    curl_easy_cleanup(transfer.handle);
+                }
+                _submitted.clear();
+
+                if (dropped.empty() == false)
+                {
+                    LOGWARN("Dropping %u transfers without completion:%s", _transfers, dropped.c_str());
+                }
+                _transfers = 0;
+
+                curl_multi_cleanup(_multi);
+                _multi = nullptr;
+            }
+        }
+
+        void CurlMultiEngine::Run()
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+
+            while (_running == true)
+            {
+                std::list<Transfer> failed;
+                for (auto& transfer : _submitted)
+                {
+                    if (curl_multi_add_handle(_multi, transfer.handle) == CURLM_OK)
+                    {
+                        _active.emplace(transfer.handle, std::move(transfer));
+                    }
+                    else
+                    {
+                        failed.push_back(std::move(transfer));
+                    }
+                }
+                _submitted.clear();
+                _transfers -= static_cast<uint32_t>(failed.size());
+                lock.unlock();
+
+                for (auto& transfer : failed)
+                {
+                    LOGERR("curl_multi_add_handle failed for %u", transfer.id);
+                    transfer.completion(CURLE_FAILED_INIT, 0);
+                    curl_easy_cleanup(transfer.handle);
+                }
+
+                int running = 0;
+                curl_multi_perform(_multi, &running);
+
+                uint32_t completed = 0;
+                int queued = 0;
+                CURLMsg* message = nullptr;
+                while ((message = curl_multi_info_read(_multi, &queued)) != nullptr)
+                {
+                    if (message->msg != CURLMSG_DONE)
+                    {
+                        continue;
+                    }
+
+                    CURL* handle = message->easy_handle;
+                    const CURLcode result = message->data.result;
+                    long httpCode = 0;
+
+                    curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &httpCode);
+                    curl_multi_remove_handle(_multi, handle);
+
+                    auto index = _active.find(handle);
+                    if (index != _active.end())
+                    {
+                        index->second.completion(result, httpCode);
+                        _active.erase(index);
+                    }
+                    curl_easy_cleanup(handle);
+                    completed++;
+                }
+
+                if (completed > 0)
+                {
+                    lock.lock();
+                    _transfers -= completed;
+                    lock.unlock();
+                }
+
+                curl_multi_poll(_multi, nullptr, 0, pollTimeoutMs, nullptr);
+                lock.lock();
+            }
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,80 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <curl/curl.h>
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Runs curl transfers on a single curl_multi event loop thread, so
+         * callers hand a prepared easy handle over and return immediately.
+         * The thread is started with the first transfer and at most
+         * maxTransfers are queued or running at a time. Completions are
+         * called on that thread, never with the engine lock held; transfers
+         * still running when the engine stops are dropped without calling
+         * their completion, and their ids are logged. */
+        class CurlMultiEngine
+        {
+            public:
+                typedef std::function<void(const CURLcode result, const long httpCode)> Completion;
+
+                explicit CurlMultiEngine(const uint32_t maxTransfers);
+                ~CurlMultiEngine();
+
+                CurlMultiEngine(const CurlMultiEngine&) = delete;
+                CurlMultiEngine& operator=(const CurlMultiEngine&) = delete;
+
+                /* Takes ownership of handle, also when the submit fails; id only
+                 * names the transfer in the log */
+                bool Submit(const uint32_t id, CURL* handle, const Completion& completion);
+                void Stop();
+
+            private:
+                struct Transfer
+                {
+                    uint32_t id;
+                    CURL* handle;
+                    Completion completion;
+                };
+
+                void Run();
+
+            private:
+                std::mutex _lock;
+                CURLM* _multi;
+                std::thread _thread;
+                bool _running;
+                bool _stopped;
+                const uint32_t _maxTransfers;
+                uint32_t _transfers;        // queued or running, guarded by _lock
+                std::list<Transfer> _submitted;
+                std::map<CURL*, Transfer> _active;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
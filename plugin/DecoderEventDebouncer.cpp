@@ -0,0 +1,102 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "DecoderEventDebouncer.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        DecoderEventDebouncer::DecoderEventDebouncer(const int status, const uint32_t window, const Policy policy)
+            : _lock()
+            , _window(window)
+            , _policy(policy)
+            , _sentStatus(status)
+            , _pendingStatus(status)
+            , _pendingChanges(0)
+            , _deadline(0)
+            , _sent(0)
+            , _suppressed(0)
+        {
+        }
+
+        void DecoderEventDebouncer::Configure(const uint32_t window, const Policy policy)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            _window = window;
+            _policy = policy;
+        }
+
+        void DecoderEventDebouncer::Changed(const int status, const uint64_t now)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            if (_pendingChanges == 0)
+            {
+                _deadline = now + _window;
+            }
+            _pendingStatus = status;
+            _pendingChanges++;
+        }
+
+        bool DecoderEventDebouncer::Due(const uint64_t now, int& status)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            if ((_pendingChanges == 0) || (now < _deadline))
+            {
+                return false;
+            }
+
+            const bool send = ((_policy == LATEST) || (_pendingStatus != _sentStatus));
+            _suppressed += (send ? _pendingChanges - 1 : _pendingChanges);
+            _pendingChanges = 0;
+            _deadline = 0;
+
+            if (!send)
+            {
+                return false;
+            }
+            _sentStatus = _pendingStatus;
+            _sent++;
+            status = _pendingStatus;
+            return true;
+        }
+
+        uint64_t DecoderEventDebouncer::Deadline() const
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _deadline;
+        }
+
+        uint32_t DecoderEventDebouncer::Sent() const
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _sent;
+        }
+
+        uint32_t DecoderEventDebouncer::Suppressed() const
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _suppressed;
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
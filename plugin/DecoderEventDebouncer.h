@@ -0,0 +1,82 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Holds back AV decoder status change events for a short window so
+         * flapping during a channel change reaches subscribers once. The
+         * window opens at the first change and closes window ms later, so no
+         * event is late by more than the window. At the end of the window:
+         *
+         *   LATEST  the last status seen is sent
+         *   NET     the last status seen is sent only if it differs from the
+         *           last one sent, ACTIVE->IDLE->ACTIVE sends nothing
+         *
+         * Changes that did not become an event are counted as suppressed.
+         * A window of 0 sends every change as it is seen. */
+        class DecoderEventDebouncer
+        {
+            public:
+                enum Policy
+                {
+                    LATEST,
+                    NET
+                };
+
+                DecoderEventDebouncer(const int status, const uint32_t window, const Policy policy);
+                ~DecoderEventDebouncer() = default;
+
+                DecoderEventDebouncer(const DecoderEventDebouncer&) = delete;
+                DecoderEventDebouncer& operator=(const DecoderEventDebouncer&) = delete;
+
+                void Configure(const uint32_t window, const Policy policy);
+
+                /* A status change seen at now (ms, monotonic) */
+                void Changed(const int status, const uint64_t now);
+
+                /* True with the status to send once the window is over */
+                bool Due(const uint64_t now, int& status);
+
+                /* When the open window closes, 0 if none is open */
+                uint64_t Deadline() const;
+
+                uint32_t Sent() const;
+                uint32_t Suppressed() const;
+
+            private:
+                mutable std::mutex _lock;
+                uint32_t _window;
+                Policy _policy;
+                int _sentStatus;
+                int _pendingStatus;
+                uint32_t _pendingChanges;
+                uint64_t _deadline;
+                uint32_t _sent;
+                uint32_t _suppressed;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,121 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "DecoderHistory.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        constexpr int DecoderHistory::States;
+        constexpr uint32_t DecoderHistory::Capacity;
+
+        static inline int validState(const int status)
+        {
+            return (((status >= 0) && (status < DecoderHistory::States)) ? status : 0);
+        }
+
+        static uint32_t percentile(std::vector<uint32_t>& lengths, const uint32_t percent)
+        {
+            const size_t index = ((lengths.size() - 1) * percent + 50) / 100;
+            std::nth_element(lengths.begin(), lengths.begin() + index, lengths.end());
+            return lengths[index];
+        }
+
+        DecoderHistory::DecoderHistory(const int status, const uint64_t now)
+            : _lock()
+            , _transitions()
+            , _next(1)
+            , _count(1)
+        {
+            _transitions[0].time = now;
+            _transitions[0].status = validState(status);
+        }
+
+        void DecoderHistory::Record(const int status, const uint64_t now)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            _transitions[_next].time = now;
+            _transitions[_next].status = validState(status);
+            _next = (_next + 1) % Capacity;
+            if (_count < Capacity)
+            {
+                _count++;
+            }
+        }
+
+        void DecoderHistory::Get(const uint64_t window, const uint64_t now, Statistics statistics[States], uint64_t& covered, uint32_t& transitions) const
+        {
+            std::vector<uint32_t> lengths[States];
+            const uint64_t start = (((window == 0) || (window > now)) ? 0 : now - window);
+            uint64_t reach = now;
+
+            memset(statistics, 0, sizeof(Statistics) * States);
+            transitions = 0;
+
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+
+                // newest first, each transition's stretch ends where the next one starts
+                uint64_t end = now;
+                for (uint32_t walked = 0; walked < _count; walked++)
+                {
+                    const Transition& transition = _transitions[(_next + Capacity - 1 - walked) % Capacity];
+                    const uint64_t from = std::max(transition.time, start);
+
+                    if (end > from)
+                    {
+                        lengths[transition.status].push_back(static_cast<uint32_t>(std::min<uint64_t>(end - from, UINT32_MAX)));
+                        statistics[transition.status].time += (end - from);
+                    }
+                    reach = from;
+                    if (transition.time <= start)
+                    {
+                        break;
+                    }
+                    // the oldest entry is where recording started, not a change
+                    if ((walked + 1 < _count) || (_count == Capacity))
+                    {
+                        transitions++;
+                    }
+                    end = transition.time;
+                }
+            }
+
+            covered = now - reach;
+            for (int state = 0; state < States; state++)
+            {
+                statistics[state].episodes = static_cast<uint32_t>(lengths[state].size());
+                if (lengths[state].empty() == false)
+                {
+                    statistics[state].max = *std::max_element(lengths[state].begin(), lengths[state].end());
+                    statistics[state].p50 = percentile(lengths[state], 50);
+                    statistics[state].p90 = percentile(lengths[state], 90);
+                    statistics[state].p99 = percentile(lengths[state], 99);
+                }
+            }
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
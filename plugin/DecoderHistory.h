@@ -0,0 +1,80 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Fixed size ring buffer of decoder status transitions. Recording is
+         * a store into preallocated memory under a short lock, so it can stay
+         * on in production; once full the oldest transitions are overwritten
+         * and queries only reach back as far as the buffer does. Times are
+         * monotonic milliseconds, states the decoder status values IDLE,
+         * PAUSED, ACTIVE. */
+        class DecoderHistory
+        {
+            public:
+                static constexpr int States = 3;
+                static constexpr uint32_t Capacity = 2048;
+
+                struct Statistics
+                {
+                    uint64_t time;           // ms spent in the state within the window
+                    uint32_t episodes;       // stretches in the state overlapping the window
+                    uint32_t p50;            // episode length percentiles, ms
+                    uint32_t p90;
+                    uint32_t p99;
+                    uint32_t max;
+                };
+
+                /* status is the state the decoder is assumed in from now on */
+                DecoderHistory(const int status, const uint64_t now);
+                ~DecoderHistory() = default;
+
+                DecoderHistory(const DecoderHistory&) = delete;
+                DecoderHistory& operator=(const DecoderHistory&) = delete;
+
+                void Record(const int status, const uint64_t now);
+
+                /* Statistics over the last window ms (0 for everything kept), per
+                 * state. covered is how much of the window the buffer reaches,
+                 * transitions the number of changes inside it. */
+                void Get(const uint64_t window, const uint64_t now, Statistics statistics[States], uint64_t& covered, uint32_t& transitions) const;
+
+            private:
+                struct Transition
+                {
+                    uint64_t time;
+                    int status;
+                };
+
+                mutable std::mutex _lock;
+                std::array<Transition, Capacity> _transitions;
+                uint32_t _next;
+                uint32_t _count;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,98 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "DecoderPollScheduler.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        constexpr int DecoderPollScheduler::Modes;
+        constexpr uint32_t DecoderPollScheduler::MaxInterval;
+
+        DecoderPollScheduler::DecoderPollScheduler(const uint32_t minInterval, const uint32_t maxInterval)
+            : _lock()
+            , _minInterval(0)
+            , _maxInterval(0)
+            , _interval(0)
+            , _mode(0)
+            , _last(std::chrono::steady_clock::now())
+        {
+            memset(_statistics, 0, sizeof(_statistics));
+            Bounds(minInterval, maxInterval);
+        }
+
+        void DecoderPollScheduler::Bounds(const uint32_t minInterval, const uint32_t maxInterval)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            _minInterval = std::min(std::max(minInterval, 1u), MaxInterval);
+            _maxInterval = std::min(std::max(maxInterval, _minInterval), MaxInterval);
+            _interval = _minInterval;
+        }
+
+        uint32_t DecoderPollScheduler::Polled(const int status)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            const int mode = ((status >= 0) && (status < Modes)) ? status : 0;
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            const uint32_t elapsed = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now - _last).count());
+            Statistics& current = _statistics[_mode];
+
+            _last = now;
+            current.wakeups++;
+            current.time += elapsed;
+
+            if (mode != _mode)
+            {
+                // the change happened at some point since the previous poll
+                current.transitions++;
+                current.latency += elapsed;
+                current.maxLatency = std::max(current.maxLatency, elapsed);
+                _mode = mode;
+                _interval = _minInterval;
+            }
+            else if (mode == 0)
+            {
+                _interval = static_cast<uint32_t>(std::min<uint64_t>(static_cast<uint64_t>(_interval) * 2, _maxInterval));
+            }
+            else
+            {
+                _interval = _minInterval;
+            }
+            return _interval;
+        }
+
+        uint32_t DecoderPollScheduler::Interval() const
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _interval;
+        }
+
+        DecoderPollScheduler::Statistics DecoderPollScheduler::Get(const int mode) const
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _statistics[((mode >= 0) && (mode < Modes)) ? mode : 0];
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,81 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Picks the next AV decoder poll interval. After a status change and
+         * while the decoder is PAUSED or ACTIVE the minimum interval is used;
+         * while it stays IDLE the interval doubles per poll up to the maximum.
+         * Every poll is accounted to the mode the decoder was in, so the cost
+         * (wakeups per hour) and the benefit (how late a change can have been
+         * seen, at most the time since the previous poll) can be compared per
+         * mode. Modes are the decoder status values: IDLE, PAUSED, ACTIVE.
+         * The maximum is capped at MaxInterval, as GetAVDecoderStatus serves
+         * the last poll result and can be that far behind. */
+        class DecoderPollScheduler
+        {
+            public:
+                static constexpr int Modes = 3;
+                static constexpr uint32_t MaxInterval = 5000;   // ms
+
+                struct Statistics
+                {
+                    uint32_t wakeups;
+                    uint64_t time;           // ms spent in the mode
+                    uint32_t transitions;    // changes detected out of the mode
+                    uint64_t latency;        // sum of the detection latency bounds, ms
+                    uint32_t maxLatency;     // ms
+                };
+
+                DecoderPollScheduler(const uint32_t minInterval, const uint32_t maxInterval);
+                ~DecoderPollScheduler() = default;
+
+                DecoderPollScheduler(const DecoderPollScheduler&) = delete;
+                DecoderPollScheduler& operator=(const DecoderPollScheduler&) = delete;
+
+                /* Bounds in milliseconds, both capped at MaxInterval, a maximum
+                 * below the minimum is raised to it */
+                void Bounds(const uint32_t minInterval, const uint32_t maxInterval);
+
+                /* Records a poll that read status, returns the interval until the next one in ms */
+                uint32_t Polled(const int status);
+
+                uint32_t Interval() const;
+                Statistics Get(const int mode) const;
+
+            private:
+                mutable std::mutex _lock;
+                uint32_t _minInterval;
+                uint32_t _maxInterval;
+                uint32_t _interval;
+                int _mode;
+                std::chrono::steady_clock::time_point _last;
+                Statistics _statistics[Modes];
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
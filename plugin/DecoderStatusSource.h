@@ -0,0 +1,70 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Where the AV poll thread reads decoder states from. States are the
+         * decoder status values IDLE, PAUSED, ACTIVE; the most active status is
+         * the highest state of any decoder. Open is called once, before any
+         * other method, and calls are serialized by the poll lock. */
+        class DecoderStatusSource
+        {
+            public:
+                enum Type
+                {
+                    VIDEO,
+                    AUDIO
+                };
+
+                enum State
+                {
+                    IDLE,
+                    PAUSED,
+                    ACTIVE
+                };
+
+                struct Decoder
+                {
+                    Type type;
+                    uint32_t id;
+                };
+
+                virtual ~DecoderStatusSource() = default;
+
+                /* False when the backend can not be used, the source is then dropped */
+                virtual bool Open() = 0;
+
+                /* The decoder set is fixed once the source is open */
+                virtual void Decoders(std::vector<Decoder>& decoders) = 0;
+
+                virtual int MostActive() = 0;
+
+                /* False when the state of this decoder can not be read right now */
+                virtual bool DecoderState(const Type type, const uint32_t id, int& state) = 0;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
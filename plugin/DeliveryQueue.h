@@ -0,0 +1,269 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Bounded FIFO of events waiting to be delivered to one subscriber.
+         * At most one drain runs per queue: Push says when the caller has to
+         * start one, and Pop ends it once the queue is empty. When the queue
+         * is full the overflow policy decides:
+         *
+         *   DROP_OLDEST  the oldest queued event is dropped
+         *   COALESCE     the oldest queued event the new one supersedes is
+         *                replaced, if there is none the oldest is dropped
+         *   DISCONNECT   the queue is closed, the subscriber is to be dropped
+         *
+         * Times are in microseconds on any monotonic clock. */
+        template <typename EVENT>
+        class DeliveryQueue
+        {
+            public:
+                enum Overflow
+                {
+                    DROP_OLDEST,
+                    COALESCE,
+                    DISCONNECT
+                };
+
+                enum Result
+                {
+                    QUEUED,     // a drain is running already
+                    START,      // the caller has to start a drain
+                    CLOSED      // not queued, the queue overflowed with DISCONNECT
+                };
+
+                struct Statistics
+                {
+                    uint32_t queued;
+                    uint32_t maxQueued;
+                    uint32_t delivered;
+                    uint32_t dropped;
+                    uint32_t coalesced;
+                    uint64_t latency;       // sum of the time from Push to delivery done, us
+                    uint32_t maxLatency;    // us
+                };
+
+                /* True when incoming makes queued obsolete */
+                typedef std::function<bool(const EVENT& queued, const EVENT& incoming)> Supersedes;
+
+                DeliveryQueue(const uint32_t capacity, const Overflow overflow, const Supersedes& supersedes)
+                    : _lock()
+                    , _supersedes(supersedes)
+                    , _overflow(overflow)
+                    , _entries(capacity > 0 ? capacity : 1)
+                    , _head(0)
+                    , _count(0)
+                    , _draining(false)
+                    , _closed(false)
+                {
+                    memset(&_statistics, 0, sizeof(_statistics));
+                }
+                ~DeliveryQueue() = default;
+
+                DeliveryQueue(const DeliveryQueue&) = delete;
+                DeliveryQueue& operator=(const DeliveryQueue&) = delete;
+
+                Result Push(const EVENT& event, const uint64_t now)
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+
+                    if (_closed)
+                    {
+                        return CLOSED;
+                    }
+
+                    if (_count == _entries.size())
+                    {
+                        if (_overflow == DISCONNECT)
+                        {
+                            _closed = true;
+                            _statistics.dropped += static_cast<uint32_t>(_count) + 1;
+                            Clear();
+                            return CLOSED;
+                        }
+
+                        size_t index = _count;
+                        if (_overflow == COALESCE)
+                        {
+                            index = 0;
+                            while ((index < _count) && (!_supersedes(At(index).event, event)))
+                            {
+                                index++;
+                            }
+                        }
+                        if (index < _count)
+                        {
+                            _statistics.coalesced++;
+                        }
+                        else
+                        {
+                            index = 0;
+                            _statistics.dropped++;
+                        }
+                        Erase(index);
+                    }
+
+                    Entry& entry = At(_count);
+                    entry.event = event;
+                    entry.time = now;
+                    _count++;
+                    if (_count > _statistics.maxQueued)
+                    {
+                        _statistics.maxQueued = static_cast<uint32_t>(_count);
+                    }
+
+                    if (_draining)
+                    {
+                        return QUEUED;
+                    }
+                    _draining = true;
+                    return START;
+                }
+
+                /* Next event for the running drain, false ends the drain */
+                bool Pop(EVENT& event, uint64_t& queued)
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+
+                    if ((_count == 0) || (_closed))
+                    {
+                        _draining = false;
+                        return false;
+                    }
+
+                    Entry& entry = At(0);
+                    event = std::move(entry.event);
+                    entry.event = EVENT();
+                    queued = entry.time;
+                    _head = (_head + 1) % _entries.size();
+                    _count--;
+                    return true;
+                }
+
+                /* A popped event was handed to the subscriber */
+                void Delivered(const uint64_t latency)
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+
+                    _statistics.delivered++;
+                    _statistics.latency += latency;
+                    if (latency > _statistics.maxLatency)
+                    {
+                        _statistics.maxLatency = static_cast<uint32_t>(latency);
+                    }
+                }
+
+                /* Applies to events queued from now on, queued events beyond a
+                 * smaller capacity are dropped oldest first */
+                void Configure(const uint32_t capacity, const Overflow overflow)
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    std::vector<Entry> entries(capacity > 0 ? capacity : 1);
+
+                    while (_count > entries.size())
+                    {
+                        Erase(0);
+                        _statistics.dropped++;
+                    }
+                    for (size_t index = 0; index < _count; index++)
+                    {
+                        entries[index] = std::move(At(index));
+                    }
+                    _entries.swap(entries);
+                    _head = 0;
+                    _overflow = overflow;
+                }
+
+                /* Nothing more is queued or delivered, the running drain ends */
+                void Close()
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    _closed = true;
+                    Clear();
+                }
+
+                bool Closed() const
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    return _closed;
+                }
+
+                Statistics Get() const
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    Statistics statistics = _statistics;
+                    statistics.queued = static_cast<uint32_t>(_count);
+                    return statistics;
+                }
+
+            private:
+                struct Entry
+                {
+                    EVENT event;
+                    uint64_t time;
+                };
+
+                Entry& At(const size_t index)
+                {
+                    return _entries[(_head + index) % _entries.size()];
+                }
+
+                void Erase(const size_t index)
+                {
+                    for (size_t next = index + 1; next < _count; next++)
+                    {
+                        At(next - 1) = std::move(At(next));
+                    }
+                    _count--;
+                    At(_count).event = EVENT();
+                }
+
+                void Clear()
+                {
+                    while (_count > 0)
+                    {
+                        _count--;
+                        At(_count).event = EVENT();
+                    }
+                }
+
+            private:
+                mutable std::mutex _lock;
+                const Supersedes _supersedes;
+                Overflow _overflow;
+                std::vector<Entry> _entries;
+                size_t _head;
+                size_t _count;
+                bool _draining;
+                bool _closed;
+                Statistics _statistics;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
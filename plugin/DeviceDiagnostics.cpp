@@ -48,7 +48,7 @@ namespace WPEFramework
      **/
     SERVICE_REGISTRATION(DeviceDiagnostics, API_VERSION_NUMBER_MAJOR, API_VERSION_NUMBER_MINOR, API_VERSION_NUMBER_PATCH);
 
-    DeviceDiagnostics::DeviceDiagnostics() : _service(nullptr), _connectionId(0), _deviceDiagnostics(nullptr), _deviceDiagnosticsNotification(this)
+    DeviceDiagnostics::DeviceDiagnostics() : _service(nullptr), _connectionId(0), _deviceDiagnostics(nullptr), _deviceDiagnosticsExt(nullptr), _deviceDiagnosticsNotification(this)
     {
         SYSLOG(Logging::Startup, (_T("DeviceDiagnostics Constructor")));
     }
@@ -65,6 +65,7 @@ namespace WPEFramework
         ASSERT(nullptr != service);
         ASSERT(nullptr == _service);
         ASSERT(nullptr == _deviceDiagnostics);
+        ASSERT(nullptr == _deviceDiagnosticsExt);
         ASSERT(0 == _connectionId);
 
         SYSLOG(Logging::Startup, (_T("DeviceDiagnostics::Initialize: PID=%u"), getpid()));
@@ -77,10 +78,36 @@ namespace WPEFramework
 
         if(nullptr != _deviceDiagnostics)
         {
+            Exchange::IConfiguration* configuration = _deviceDiagnostics->QueryInterface<Exchange::IConfiguration>();
+            if (nullptr != configuration)
+            {
+                if (configuration->Configure(service) != Core::ERROR_NONE)
+                {
+                    message = _T("DeviceDiagnostics could not be configured");
+                }
+                configuration->Release();
+            }
+
             // Register for notifications
             _deviceDiagnostics->Register(&_deviceDiagnosticsNotification);
             // Invoking Plugin API register to wpeframework
             Exchange::JDeviceDiagnostics::Register(*this, _deviceDiagnostics);
+
+            _deviceDiagnosticsExt = _deviceDiagnostics->QueryInterface<Exchange::IDeviceDiagnosticsExt>();
+            if (nullptr != _deviceDiagnosticsExt)
+            {
+                // the AV status already reaches JSON-RPC as onAVDecoderStatusChanged
+                Exchange::IDeviceDiagnosticsExt::EventFilter filter;
+                filter.events = Exchange::IDeviceDiagnosticsExt::EVENT_DECODER_STATE | Exchange::IDeviceDiagnosticsExt::EVENT_CONFIGURATION_RESULT | Exchange::IDeviceDiagnosticsExt::EVENT_MILESTONE_LOGGED;
+                filter.states = 0;
+                filter.minInterval = 0;
+                _deviceDiagnosticsExt->RegisterFiltered(&_deviceDiagnosticsNotification, filter);
+                Exchange::JDeviceDiagnosticsExt::Register(*this, _deviceDiagnosticsExt);
+            }
+            else
+            {
+                SYSLOG(Logging::Startup, (_T("DeviceDiagnostics::Initialize: IDeviceDiagnosticsExt is not available")));
+            }
         }
         else
         {
@@ -100,6 +127,14 @@ namespace WPEFramework
         // Make sure the Activated and Deactivated are no longer called before we start cleaning up..
         _service->Unregister(&_deviceDiagnosticsNotification);
 
+        if (nullptr != _deviceDiagnosticsExt)
+        {
+            _deviceDiagnosticsExt->Unregister(&_deviceDiagnosticsNotification);
+            Exchange::JDeviceDiagnosticsExt::Unregister(*this);
+            _deviceDiagnosticsExt->Release();
+            _deviceDiagnosticsExt = nullptr;
+        }
+
         if (nullptr != _deviceDiagnostics)
         {
 
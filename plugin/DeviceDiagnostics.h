@@ -21,8 +21,11 @@
 
 #include "Module.h"
 #include <interfaces/IDeviceDiagnostics.h>
+#include <interfaces/IConfiguration.h>
 #include <interfaces/json/JDeviceDiagnostics.h>
 #include <interfaces/json/JsonData_DeviceDiagnostics.h>
+#include "interfaces/IDeviceDiagnosticsExt.h"
+#include "JDeviceDiagnosticsExt.h"
 #include "UtilsLogging.h"
 #include "tracing/Logging.h"
 
@@ -33,7 +36,7 @@ namespace WPEFramework
         class DeviceDiagnostics : public PluginHost::IPlugin, public PluginHost::JSONRPC 
         {
             private:
-                class Notification : public RPC::IRemoteConnection::INotification, public Exchange::IDeviceDiagnostics::INotification
+                class Notification : public RPC::IRemoteConnection::INotification, public Exchange::IDeviceDiagnostics::INotification, public Exchange::IDeviceDiagnosticsExt::INotification
                 {
                     private:
                         Notification() = delete;
@@ -53,6 +56,7 @@ namespace WPEFramework
 
                         BEGIN_INTERFACE_MAP(Notification)
                         INTERFACE_ENTRY(Exchange::IDeviceDiagnostics::INotification)
+                        INTERFACE_ENTRY(Exchange::IDeviceDiagnosticsExt::INotification)
                         INTERFACE_ENTRY(RPC::IRemoteConnection::INotification)
                         END_INTERFACE_MAP
 
@@ -71,6 +75,24 @@ namespace WPEFramework
                             Exchange::JDeviceDiagnostics::Event::OnAVDecoderStatusChanged(_parent, AVDecoderStatus);
                         }
 
+                        void OnConfigurationResult(const uint32_t requestId, const bool success, const string& paramList, const uint64_t sequence, const uint64_t timestamp) override
+                        {
+                            LOGINFO("OnConfigurationResult: requestId %u success %d\n", requestId, success);
+                            Exchange::JDeviceDiagnosticsExt::Event::OnConfigurationResult(_parent, requestId, success, paramList, sequence, timestamp);
+                        }
+
+                        void OnMilestoneLogged(const string& milestones, const uint64_t sequence, const uint64_t timestamp) override
+                        {
+                            LOGINFO("OnMilestoneLogged: %s\n", milestones.c_str());
+                            Exchange::JDeviceDiagnosticsExt::Event::OnMilestoneLogged(_parent, milestones, sequence, timestamp);
+                        }
+
+                        void OnDecoderStateChanged(const string& type, const uint32_t id, const string& status, const uint64_t sequence, const uint64_t timestamp) override
+                        {
+                            LOGINFO("OnDecoderStateChanged: %s %u %s\n", type.c_str(), id, status.c_str());
+                            Exchange::JDeviceDiagnosticsExt::Event::OnDecoderStateChanged(_parent, type, id, status, sequence, timestamp);
+                        }
+
                     private:
                         DeviceDiagnostics& _parent;
                 };
@@ -86,6 +108,7 @@ namespace WPEFramework
                     INTERFACE_ENTRY(PluginHost::IPlugin)
                     INTERFACE_ENTRY(PluginHost::IDispatcher)
                     INTERFACE_AGGREGATE(Exchange::IDeviceDiagnostics, _deviceDiagnostics)
+                    INTERFACE_AGGREGATE(Exchange::IDeviceDiagnosticsExt, _deviceDiagnosticsExt)
                     END_INTERFACE_MAP
 
                     //  IPlugin methods
@@ -101,6 +124,7 @@ namespace WPEFramework
                     PluginHost::IShell* _service{};
                     uint32_t _connectionId{};
                     Exchange::IDeviceDiagnostics* _deviceDiagnostics{};
+                    Exchange::IDeviceDiagnosticsExt* _deviceDiagnosticsExt{};
                     Core::Sink<Notification> _deviceDiagnosticsNotification;
        };
     } // namespace Plugin
@@ -18,23 +18,22 @@
 **/
 
 #include "DeviceDiagnosticsImplementation.h"
+#include "ErmDecoderStatusSource.h"
+#include "ParamListParser.h"
+#include "SimulatedDecoderStatusSource.h"
 #include <curl/curl.h>
 #include <time.h>
-#include <fstream>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <memory>
+#include <set>
 
 #include "UtilsJsonRpc.h"
 
 #define MILESTONES_LOG_FILE                     "/opt/logs/rdk_milestones.log"
 
-
-/***
- * @brief  : Used to read file contents into a vector
- * @param1[in] : Complete file name with path
- * @param2[in] : Destination list buffer to be filled with file contents
- * @return : <bool>; TRUE if operation success; else FALSE.
- */
-bool getFileContent(std::string fileName, std::list<std::string> & listOfStrs);
-
 namespace WPEFramework
 {
     namespace Plugin
@@ -43,6 +42,18 @@ namespace WPEFramework
         DeviceDiagnosticsImplementation* DeviceDiagnosticsImplementation::_instance = nullptr;
     
         const int curlTimeoutInSeconds = 30;
+        const uint8_t curlHandlePoolSize = 4;
+        const uint32_t asyncConfigurationLimit = 32;    // getConfigurationAsync requests queued or in flight
+        const char* const defaultBackendUrl = "http://127.0.0.1:10999";
+        const uint32_t defaultMilestoneQueueSize = 256;
+        const char* const defaultDecoderStatusSource = "erm";
+        const uint32_t defaultDecoderTraceSpeed = 100;
+        const char* const defaultDecoderEventCoalesce = "latest";
+        const uint32_t defaultNotificationQueueSize = 64;
+        const char* const defaultNotificationOverflow = "dropoldest";
+        const uint32_t defaultNotificationReplay = 128;
+        const char* const defaultLoggingLevel = "info";
+        const uint32_t defaultLoggingRateLimit = 20;
         static const char *decoderStatusStr[] = {
             "IDLE",
             "PAUSED",
@@ -50,291 +61,1704 @@ namespace WPEFramework
             NULL
         };
 
-        static size_t writeCurlResponse(void *ptr, size_t size, size_t nmemb, std::string stream)
+        /* parameters that never change for the lifetime of the device,
+         * served from the cache until explicitly invalidated */
+        static const char *immutableParameters[] = {
+            "Device.DeviceInfo.Manufacturer",
+            "Device.DeviceInfo.ManufacturerOUI",
+            "Device.DeviceInfo.ModelName",
+            "Device.DeviceInfo.ProductClass",
+            "Device.DeviceInfo.SerialNumber",
+            "Device.DeviceInfo.HardwareVersion",
+            NULL
+        };
+
+        class Config : public Core::JSON::Container
+        {
+            public:
+                class Parameter : public Core::JSON::Container
+                {
+                    public:
+                        Parameter()
+                            : Core::JSON::Container()
+                            , Name()
+                            , Ttl(0)
+                        {
+                            Add(_T("name"), &Name);
+                            Add(_T("ttl"), &Ttl);
+                        }
+                        Parameter(const Parameter& copy)
+                            : Core::JSON::Container()
+                            , Name(copy.Name)
+                            , Ttl(copy.Ttl)
+                        {
+                            Add(_T("name"), &Name);
+                            Add(_T("ttl"), &Ttl);
+                        }
+                        Parameter& operator=(const Parameter& rhs)
+                        {
+                            Name = rhs.Name;
+                            Ttl = rhs.Ttl;
+                            return (*this);
+                        }
+                        ~Parameter() override = default;
+
+                    public:
+                        Core::JSON::String Name;
+                        Core::JSON::DecUInt32 Ttl;
+                };
+
+                class CacheConfig : public Core::JSON::Container
+                {
+                    public:
+                        CacheConfig(const CacheConfig&) = delete;
+                        CacheConfig& operator=(const CacheConfig&) = delete;
+
+                        CacheConfig()
+                            : Core::JSON::Container()
+                            , DefaultTtl(0)
+                            , Immutable()
+                            , Parameters()
+                        {
+                            Add(_T("defaultttl"), &DefaultTtl);
+                            Add(_T("immutable"), &Immutable);
+                            Add(_T("parameters"), &Parameters);
+                        }
+                        ~CacheConfig() override = default;
+
+                    public:
+                        Core::JSON::DecUInt32 DefaultTtl;
+                        Core::JSON::ArrayType<Core::JSON::String> Immutable;
+                        Core::JSON::ArrayType<Parameter> Parameters;
+                };
+
+                class BackendConfig : public Core::JSON::Container
+                {
+                    public:
+                        BackendConfig(const BackendConfig&) = delete;
+                        BackendConfig& operator=(const BackendConfig&) = delete;
+
+                        BackendConfig()
+                            : Core::JSON::Container()
+                            , Url(defaultBackendUrl)
+                            , Socket()
+                        {
+                            Add(_T("url"), &Url);
+                            Add(_T("socket"), &Socket);
+                        }
+                        ~BackendConfig() override = default;
+
+                    public:
+                        Core::JSON::String Url;
+                        Core::JSON::String Socket;
+                };
+
+                class AVPollConfig : public Core::JSON::Container
+                {
+                    public:
+                        AVPollConfig(const AVPollConfig&) = delete;
+                        AVPollConfig& operator=(const AVPollConfig&) = delete;
+
+                        AVPollConfig()
+                            : Core::JSON::Container()
+                            , MinInterval(AVDECODERSTATUS_MIN_POLL_INTERVAL)
+                            , MaxInterval(AVDECODERSTATUS_MAX_POLL_INTERVAL)
+                            , Debounce(0)
+                            , Coalesce(defaultDecoderEventCoalesce)
+                        {
+                            Add(_T("mininterval"), &MinInterval);
+                            Add(_T("maxinterval"), &MaxInterval);
+                            Add(_T("debounce"), &Debounce);
+                            Add(_T("coalesce"), &Coalesce);
+                        }
+                        ~AVPollConfig() override = default;
+
+                    public:
+                        Core::JSON::DecUInt32 MinInterval;
+                        Core::JSON::DecUInt32 MaxInterval;
+                        Core::JSON::DecUInt32 Debounce;
+                        Core::JSON::String Coalesce;
+                };
+
+                class MilestonesConfig : public Core::JSON::Container
+                {
+                    public:
+                        MilestonesConfig(const MilestonesConfig&) = delete;
+                        MilestonesConfig& operator=(const MilestonesConfig&) = delete;
+
+                        MilestonesConfig()
+                            : Core::JSON::Container()
+                            , BatchInterval(0)
+                            , FlushInterval(0)
+                            , QueueSize(defaultMilestoneQueueSize)
+                        {
+                            Add(_T("batchinterval"), &BatchInterval);
+                            Add(_T("flushinterval"), &FlushInterval);
+                            Add(_T("queuesize"), &QueueSize);
+                        }
+                        ~MilestonesConfig() override = default;
+
+                    public:
+                        Core::JSON::DecUInt32 BatchInterval;
+                        Core::JSON::DecUInt32 FlushInterval;
+                        Core::JSON::DecUInt32 QueueSize;
+                };
+
+                class DecodersConfig : public Core::JSON::Container
+                {
+                    public:
+                        DecodersConfig(const DecodersConfig&) = delete;
+                        DecodersConfig& operator=(const DecodersConfig&) = delete;
+
+                        DecodersConfig()
+                            : Core::JSON::Container()
+                            , Source(defaultDecoderStatusSource)
+                            , Trace()
+                            , Speed(defaultDecoderTraceSpeed)
+                            , Repeat(0)
+                        {
+                            Add(_T("source"), &Source);
+                            Add(_T("trace"), &Trace);
+                            Add(_T("speed"), &Speed);
+                            Add(_T("repeat"), &Repeat);
+                        }
+                        ~DecodersConfig() override = default;
+
+                    public:
+                        Core::JSON::String Source;
+                        Core::JSON::String Trace;
+                        Core::JSON::DecUInt32 Speed;
+                        Core::JSON::DecUInt32 Repeat;
+                };
+
+                class NotificationsConfig : public Core::JSON::Container
+                {
+                    public:
+                        NotificationsConfig(const NotificationsConfig&) = delete;
+                        NotificationsConfig& operator=(const NotificationsConfig&) = delete;
+
+                        NotificationsConfig()
+                            : Core::JSON::Container()
+                            , QueueSize(defaultNotificationQueueSize)
+                            , Overflow(defaultNotificationOverflow)
+                            , Replay(defaultNotificationReplay)
+                        {
+                            Add(_T("queuesize"), &QueueSize);
+                            Add(_T("overflow"), &Overflow);
+                            Add(_T("replay"), &Replay);
+                        }
+                        ~NotificationsConfig() override = default;
+
+                    public:
+                        Core::JSON::DecUInt32 QueueSize;
+                        Core::JSON::String Overflow;
+                        Core::JSON::DecUInt32 Replay;
+                };
+
+                class LoggingConfig : public Core::JSON::Container
+                {
+                    public:
+                        LoggingConfig(const LoggingConfig&) = delete;
+                        LoggingConfig& operator=(const LoggingConfig&) = delete;
+
+                        LoggingConfig()
+                            : Core::JSON::Container()
+                            , Level(defaultLoggingLevel)
+                            , RateLimit(defaultLoggingRateLimit)
+                        {
+                            Add(_T("level"), &Level);
+                            Add(_T("ratelimit"), &RateLimit);
+                        }
+                        ~LoggingConfig() override = default;
+
+                    public:
+                        Core::JSON::String Level;
+                        Core::JSON::DecUInt32 RateLimit;
+                };
+
+            public:
+                Config(const Config&) = delete;
+                Config& operator=(const Config&) = delete;
+
+                Config()
+                    : Core::JSON::Container()
+                    , Cache()
+                    , Backend()
+                    , Milestones()
+                    , AVPoll()
+                    , Decoders()
+                    , Notifications()
+                    , Logging()
+                {
+                    Add(_T("cache"), &Cache);
+                    Add(_T("backend"), &Backend);
+                    Add(_T("milestones"), &Milestones);
+                    Add(_T("avpoll"), &AVPoll);
+                    Add(_T("decoders"), &Decoders);
+                    Add(_T("notifications"), &Notifications);
+                    Add(_T("logging"), &Logging);
+                }
+                ~Config() override = default;
+
+            public:
+                CacheConfig Cache;
+                BackendConfig Backend;
+                MilestonesConfig Milestones;
+                AVPollConfig AVPoll;
+                DecodersConfig Decoders;
+                NotificationsConfig Notifications;
+                LoggingConfig Logging;
+        };
+
+        /* The response is tokenized while it arrives, it is never buffered as a whole */
+        static size_t writeCurlResponse(void *ptr, size_t size, size_t nmemb, void *stream)
         {
             size_t realsize = size * nmemb;
-            std::string temp(static_cast<const char*>(ptr), realsize);
-            stream.append(temp);
+            static_cast<ParamListParser*>(stream)->Feed(static_cast<const char*>(ptr), realsize);
             return realsize;
         }
 
-        DeviceDiagnosticsImplementation::DeviceDiagnosticsImplementation() : _adminLock() , _service(nullptr)
-#ifdef ENABLE_ERM
-            , m_pollThreadRun(0)  // Coverity Fix: ID 582 - Uninitialized scalar field: Initialize in constructor initializer list
-#endif
+        /* decoder history times, immune to wall clock steps at boot */
+        static uint64_t monotonicMs()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        /* onAVDecoderStatusChanged payload, the status object as JSON text */
+        static DeviceDiagnosticsImplementation::EventPayload avDecoderStatusPayload(const int status)
+        {
+            std::shared_ptr<DeviceDiagnosticsImplementation::EventData> data = std::make_shared<DeviceDiagnosticsImplementation::EventData>();
+            JsonObject params;
+
+            params["avDecoderStatusChange"] = decoderStatusStr[status];
+            data->event = DeviceDiagnosticsImplementation::ON_AVDECODER_STATUSCHANGED;
+            data->text = JsonValue(params).String();
+            data->status = decoderStatusStr[status];
+            return data;
+        }
+
+        /* notification delivery latency */
+        static uint64_t monotonicUs()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        /* Sequence numbers start at the wall clock in microseconds, so they
+         * keep increasing across plugin restarts and a sequence number from an
+         * earlier run is never mistaken for one of this run */
+        static uint64_t sequenceBase()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+        }
+
+        /* Events reporting a state are remembered per key, the latest one
+         * replaces the previous */
+        static string stateKey(const DeviceDiagnosticsImplementation::EventData& data)
+        {
+            switch (data.event)
+            {
+                case DeviceDiagnosticsImplementation::ON_AVDECODER_STATUSCHANGED:
+                    return "av";
+                case DeviceDiagnosticsImplementation::ON_DECODER_STATE_CHANGED:
+                    return data.type + "/" + std::to_string(data.number);
+                default:
+                    return string();
+            }
+        }
+
+        /* EventType bit a subscriber filter selects the event with */
+        static uint8_t eventType(const DeviceDiagnosticsImplementation::Event event)
+        {
+            switch (event)
+            {
+                case DeviceDiagnosticsImplementation::ON_AVDECODER_STATUSCHANGED:
+                    return Exchange::IDeviceDiagnosticsExt::EVENT_AV_DECODER_STATUS;
+                case DeviceDiagnosticsImplementation::ON_DECODER_STATE_CHANGED:
+                    return Exchange::IDeviceDiagnosticsExt::EVENT_DECODER_STATE;
+                case DeviceDiagnosticsImplementation::ON_CONFIGURATION_RESULT:
+                    return Exchange::IDeviceDiagnosticsExt::EVENT_CONFIGURATION_RESULT;
+                case DeviceDiagnosticsImplementation::ON_MILESTONE_LOGGED:
+                    return Exchange::IDeviceDiagnosticsExt::EVENT_MILESTONE_LOGGED;
+                default:
+                    return 0;
+            }
+        }
+
+        /* EventState bit of the status the event reports, 0 if it has none */
+        static uint8_t eventState(const DeviceDiagnosticsImplementation::EventData& data)
+        {
+            if (!stateKey(data).empty())
+            {
+                for (uint8_t state = 0; state < 3; state++)
+                {
+                    if (data.status == decoderStatusStr[state])
+                    {
+                        return static_cast<uint8_t>(1 << state);
+                    }
+                }
+            }
+            return 0;
+        }
+
+        /* Runs on the milestone writer thread */
+        static void writeMilestones(const std::list<string>& markers)
+        {
+#ifdef RDK_LOG_MILESTONE
+            for (const string& marker : markers)
+            {
+                logMilestone(marker.c_str());
+            }
+#else
+            (void)markers;
+#endif
+        }
+
+        static string stringListJson(const std::list<string>& strings)
+        {
+            JsonArray list;
+            string json;
+
+            for (const string& entry : strings)
+            {
+                list.Add(entry);
+            }
+            list.ToString(json);
+            return json;
+        }
+
+        static string paramListJson(const std::list<Exchange::IDeviceDiagnostics::ParamList>& params)
+        {
+            JsonArray list;
+            string json;
+
+            for (const Exchange::IDeviceDiagnostics::ParamList& param : params)
+            {
+                JsonObject o;
+                o["name"] = param.name;
+                o["value"] = param.value;
+                list.Add(o);
+            }
+            list.ToString(json);
+            return json;
+        }
+
+        /* onConfigurationResult payload, the paramList as JSON text */
+        static DeviceDiagnosticsImplementation::EventPayload configurationResultPayload(const uint32_t requestId, const bool success, const std::list<Exchange::IDeviceDiagnostics::ParamList>& params)
+        {
+            std::shared_ptr<DeviceDiagnosticsImplementation::EventData> data = std::make_shared<DeviceDiagnosticsImplementation::EventData>();
+
+            data->event = DeviceDiagnosticsImplementation::ON_CONFIGURATION_RESULT;
+            data->text = paramListJson(params);
+            data->number = requestId;
+            data->success = success;
+            return data;
+        }
+
+        static string configurationRequest(const std::list<string>& names)
+        {
+            JsonObject requestParams;
+            JsonArray namePairs;
+            string json;
+
+            for (const string& name : names)
+            {
+                JsonObject o;
+                o["name"] = name;
+                namePairs.Add(o);
+            }
+            requestParams["paramList"] = namePairs;
+            requestParams.ToString(json);
+
+            return json;
+        }
+
+        /* State of one GetConfigurationAsync call, kept alive by its completion */
+        struct AsyncConfigurationRequest
+        {
+            AsyncConfigurationRequest()
+                : id(0)
+                , generation(0)
+                , requested()
+                , cached()
+                , postData()
+                , received()
+                , parser([this](std::string& name, std::string& value) {
+                    received.emplace_back();
+                    received.back().name = std::move(name);
+                    received.back().value = std::move(value);
+                })
+            {
+            }
+
+            uint32_t id;
+            uint32_t generation;
+            std::list<string> requested;
+            std::map<string, string> cached;
+            std::string postData;
+            std::list<Exchange::IDeviceDiagnostics::ParamList> received;
+            ParamListParser parser;
+        };
+
+        DeviceDiagnosticsImplementation::DeviceDiagnosticsImplementation() : _service(nullptr)
+            , _nextSubscriberId(1)
+            , _disconnectedSubscribers(0)
+            , _notificationQueueSize(defaultNotificationQueueSize)
+            , _notificationOverflow(EventQueue::DROP_OLDEST)
+            , _sequenceLock()
+            , _sequence(sequenceBase())
+            , _replay(defaultNotificationReplay, _sequence)
+            , _stateEvents()
+            , _curlHandlePool(curlHandlePoolSize)
+            , _asyncEngine(asyncConfigurationLimit)
+            , _nextRequestId(1)
+            , _backendUrl(defaultBackendUrl)
+            , _backendSocket()
+            , _milestoneReader(MILESTONES_LOG_FILE)
+            , _milestoneWatcher(_milestoneReader, MILESTONES_LOG_FILE, [this](std::list<string>& milestones) { onMilestoneLogged(milestones); })
+            , _milestoneLogger(writeMilestones)
+            , _decoderPollScheduler(AVDECODERSTATUS_MIN_POLL_INTERVAL, AVDECODERSTATUS_MAX_POLL_INTERVAL)
+            , _decoderReads(0)
+            , _decoderHistory(0, monotonicMs())
+            , _decoderEventDebouncer(DecoderStatusSource::IDLE, 0, DecoderEventDebouncer::LATEST)
+            , m_pollThreadRun(0)  // Coverity Fix: ID 582 - Uninitialized scalar field: Initialize in constructor initializer list
+        {
+            LOGINFO("Create DeviceDiagnosticsImplementation Instance");
+
+            DeviceDiagnosticsImplementation::_instance = this;
+        }
+
+        uint32_t DeviceDiagnosticsImplementation::Configure(PluginHost::IShell* service)
+        {
+            ASSERT(nullptr != service);
+
+            Config config;
+            config.FromString(service->ConfigLine());
+
+            const int level = Utils::Logging::LevelFromName(config.Logging.Level.Value().c_str());
+            if (level < 0)
+            {
+                LOGWARN("Unknown logging level '%s', using %s", config.Logging.Level.Value().c_str(), defaultLoggingLevel);
+            }
+            Utils::Logging::SetLevel(level < 0 ? LOG_LEVEL_INFO : level);
+            Utils::Logging::SetRateLimit(config.Logging.RateLimit.Value());
+
+            _backendUrl = config.Backend.Url.Value();
+            _backendSocket = config.Backend.Socket.Value();
+            if (_backendSocket.empty())
+            {
+                LOGINFO("Configuration backend: %s", _backendUrl.c_str());
+            }
+            else
+            {
+                LOGINFO("Configuration backend: %s over unix socket %s", _backendUrl.c_str(), _backendSocket.c_str());
+            }
+
+            _parameterCache.DefaultTtl(config.Cache.DefaultTtl.Value());
+
+            for (const char* const* name = immutableParameters; *name != nullptr; ++name)
+            {
+                _parameterCache.Ttl(*name, ParameterCache::Infinite);
+            }
+
+            auto immutable = config.Cache.Immutable.Elements();
+            while (immutable.Next() == true)
+            {
+                _parameterCache.Ttl(immutable.Current().Value(), ParameterCache::Infinite);
+            }
+
+            auto parameter = config.Cache.Parameters.Elements();
+            while (parameter.Next() == true)
+            {
+                _parameterCache.Ttl(parameter.Current().Name.Value(), parameter.Current().Ttl.Value());
+            }
+
+            if (config.AVPoll.MaxInterval.Value() > DecoderPollScheduler::MaxInterval)
+            {
+                LOGWARN("AV decoder poll interval capped at %u ms", DecoderPollScheduler::MaxInterval);
+            }
+            _decoderPollScheduler.Bounds(config.AVPoll.MinInterval.Value(), config.AVPoll.MaxInterval.Value());
+            LOGINFO("AV decoder poll interval %u..%u ms", config.AVPoll.MinInterval.Value(), config.AVPoll.MaxInterval.Value());
+
+            const string coalesce = config.AVPoll.Coalesce.Value();
+            if ((coalesce != "latest") && (coalesce != "net"))
+            {
+                LOGWARN("Unknown AV decoder event coalescing '%s', using latest", coalesce.c_str());
+            }
+            _decoderEventDebouncer.Configure(config.AVPoll.Debounce.Value(), (coalesce == "net" ? DecoderEventDebouncer::NET : DecoderEventDebouncer::LATEST));
+            if (config.AVPoll.Debounce.Value() != 0)
+            {
+                LOGINFO("AV decoder status events debounced for %u ms, %s status", config.AVPoll.Debounce.Value(), (coalesce == "net" ? "net" : "latest"));
+            }
+
+            const string overflow = config.Notifications.Overflow.Value();
+            EventQueue::Overflow policy = EventQueue::DROP_OLDEST;
+            if (overflow == "coalesce")
+            {
+                policy = EventQueue::COALESCE;
+            }
+            else if (overflow == "disconnect")
+            {
+                policy = EventQueue::DISCONNECT;
+            }
+            else if (overflow != "dropoldest")
+            {
+                LOGWARN("Unknown notification overflow policy '%s', using dropoldest", overflow.c_str());
+            }
+            _notificationQueueSize = config.Notifications.QueueSize.Value();
+            _notificationOverflow = policy;
+            for (SubscriberList<Subscriber>* list : { &_deviceDiagnosticsNotification, &_deviceDiagnosticsExtNotification })
+            {
+                const auto subscribers = list->Get();
+                for (const auto& subscriber : *subscribers)
+                {
+                    subscriber->queue.Configure(config.Notifications.QueueSize.Value(), policy);
+                }
+            }
+            LOGINFO("Notification queues hold %u events, %s when full", config.Notifications.QueueSize.Value(), overflow.c_str());
+
+            _sequenceLock.lock();
+            _replay.Configure(config.Notifications.Replay.Value());
+            _sequenceLock.unlock();
+
+            // nobody is registered yet, this only records the status the
+            // poll thread starts from for replay
+            onDecoderStatusChange(DecoderStatusSource::IDLE);
+
+            openDecoderStatusSource(config.Decoders.Source.Value(), config.Decoders.Trace.Value(),
+                config.Decoders.Speed.Value(), config.Decoders.Repeat.Value());
+
+            _milestoneLogger.Start(config.Milestones.QueueSize.Value(), config.Milestones.FlushInterval.Value());
+
+            if (!_milestoneWatcher.Start(config.Milestones.BatchInterval.Value()))
+            {
+                LOGWARN("New milestones will not be notified");
+            }
+
+            return Core::ERROR_NONE;
+        }
+
+        DeviceDiagnosticsImplementation::~DeviceDiagnosticsImplementation()
+        {
+            // no more events once destruction starts, queued milestones are still written
+            _milestoneWatcher.Stop();
+            _milestoneLogger.Stop();
+            _asyncEngine.Stop();
+
+            m_AVDecoderStatusLock.lock();
+            m_pollThreadRun = 0;
+            m_AVDecoderStatusLock.unlock();
+            m_avDecoderStatusCv.notify_one();
+			if (m_AVPollThread.joinable())
+			{
+                m_AVPollThread.join();
+			}
+            m_decoderStatusSource.reset();
+            DeviceDiagnosticsImplementation::_instance = nullptr;
+            _service = nullptr;
+        }
+
+        /* With COALESCE an event replaces a queued one carrying a state it overrides */
+        static bool supersedes(const DeviceDiagnosticsImplementation::SequencedEvent& queued, const DeviceDiagnosticsImplementation::SequencedEvent& incoming)
+        {
+            const string key = stateKey(*incoming.payload);
+            return ((!key.empty()) && (key == stateKey(*queued.payload)));
+        }
+
+        DeviceDiagnosticsImplementation::Subscriber::Subscriber(const uint32_t id, const char* interface, const uint32_t capacity, const EventQueue::Overflow overflow, const EventFilter& wanted)
+            : id(id)
+            , interface(interface)
+            , filter(wanted.events, wanted.states, wanted.minInterval)
+            , queue(capacity, overflow, supersedes)
+        {
+        }
+
+        template <typename INTERFACE>
+        Core::hresult DeviceDiagnosticsImplementation::registerSubscriber(SubscriberList<Subscriber>& subscribers, INTERFACE* notification, const char* interface, const std::vector<SequencedEvent>& replay, const EventFilter& filter)
+        {
+            ASSERT (nullptr != notification);
+
+            // the replay has to fit, live events queue up behind it
+            const uint32_t capacity = std::max(_notificationQueueSize.load(), static_cast<uint32_t>(replay.size()));
+            std::shared_ptr<Subscriber> subscriber = std::make_shared<SubscriberType<INTERFACE>>(notification, _nextSubscriberId++, interface,
+                capacity, static_cast<EventQueue::Overflow>(_notificationOverflow.load()), filter);
+
+            // Make sure we can't register the same notification callback multiple times
+            if (!subscribers.Add(subscriber))
+            {
+                LOGERR("same notification is registered already");
+                return Core::ERROR_NONE;
+            }
+
+            const uint64_t now = monotonicUs();
+            for (const SequencedEvent& event : replay)
+            {
+                if (subscriber->queue.Push(event, now) == EventQueue::START)
+                {
+                    Core::IWorkerPool::Instance().Submit(Job::Create(this, subscriber));
+                }
+            }
+
+            return Core::ERROR_NONE;
+        }
+
+        Core::hresult DeviceDiagnosticsImplementation::Register(Exchange::IDeviceDiagnostics::INotification *notification)
+        {
+            CallMetrics::Call call(_apiMetrics[API_REGISTER]);
+            return call.Result(registerSubscriber(_deviceDiagnosticsNotification, notification, "IDeviceDiagnostics", std::vector<SequencedEvent>(), EventFilter()));
+        }
+
+        Core::hresult DeviceDiagnosticsImplementation::Unregister(Exchange::IDeviceDiagnostics::INotification *notification )
+        {
+            CallMetrics::Call call(_apiMetrics[API_UNREGISTER]);
+            Core::hresult status = Core::ERROR_GENERAL;
+
+            ASSERT (nullptr != notification);
+
+            // we just unregister one notification once, a delivery already
+            // in progress may still reach it, what is still queued is not
+            std::shared_ptr<Subscriber> subscriber = _deviceDiagnosticsNotification.Remove(notification);
+            if (subscriber)
+            {
+                subscriber->queue.Close();
+                status = Core::ERROR_NONE;
+            }
+            else
+            {
+                LOGERR("notification not found");
+            }
+
+            return call.Result(status);
+        }
+
+        Core::hresult DeviceDiagnosticsImplementation::Register(Exchange::IDeviceDiagnosticsExt::INotification *notification)
+        {
+            return registerSubscriber(_deviceDiagnosticsExtNotification, notification, "IDeviceDiagnosticsExt", std::vector<SequencedEvent>(), EventFilter());
+        }
+
+        Core::hresult DeviceDiagnosticsImplementation::RegisterFiltered(Exchange::IDeviceDiagnosticsExt::INotification* notification, const EventFilter& filter)
+        {
+            LOGINFO("events 0x%02x states 0x%02x, %u ms apart", filter.events, filter.states, filter.minInterval);
+            return registerSubscriber(_deviceDiagnosticsExtNotification, notification, "IDeviceDiagnosticsExt", std::vector<SequencedEvent>(), filter);
+        }
+
+        /* Events are numbered and queued under _sequenceLock, holding it while
+         * the replay is queued puts the replay right before the live events */
+        Core::hresult DeviceDiagnosticsImplementation::RegisterSince(Exchange::IDeviceDiagnosticsExt::INotification* notification, const uint64_t since, bool& complete)
+        {
+            std::lock_guard<std::mutex> lock(_sequenceLock);
+            std::vector<SequencedEvent> replay;
+
+            complete = _replay.Since(since, replay);
+            if (!complete)
+            {
+                // what was lost is made up for by the latest state of every decoder
+                const uint64_t first = (replay.empty() ? std::numeric_limits<uint64_t>::max() : replay.front().sequence);
+                std::vector<SequencedEvent> states;
+                for (const auto& state : _stateEvents)
+                {
+                    if (state.second.sequence < first)
+                    {
+                        states.push_back(state.second);
+                    }
+                }
+                std::sort(states.begin(), states.end(), [](const SequencedEvent& a, const SequencedEvent& b) { return (a.sequence < b.sequence); });
+                replay.insert(replay.begin(), states.begin(), states.end());
+                LOGWARN("Events after %llu are gone, replaying %zu decoder states", static_cast<unsigned long long>(since), states.size());
+            }
+            LOGINFO("Replaying %zu events after %llu", replay.size(), static_cast<unsigned long long>(since));
+
+            return registerSubscriber(_deviceDiagnosticsExtNotification, notification, "IDeviceDiagnosticsExt", replay, EventFilter());
+        }
+
+        Core::hresult DeviceDiagnosticsImplementation::Unregister(Exchange::IDeviceDiagnosticsExt::INotification *notification)
+        {
+            Core::hresult status = Core::ERROR_GENERAL;
+
+            ASSERT (nullptr != notification);
+
+            std::shared_ptr<Subscriber> subscriber = _deviceDiagnosticsExtNotification.Remove(notification);
+            if (subscriber)
+            {
+                subscriber->queue.Close();
+                status = Core::ERROR_NONE;
+            }
+            else
+            {
+                LOGERR("notification not found");
+            }
+
+            return status;
+        }
+
+        /* Numbers the event and keeps it for replay. IDeviceDiagnosticsExt
+         * subscribers get every event, IDeviceDiagnostics ones the AV status */
+        void DeviceDiagnosticsImplementation::dispatchEvent(const EventPayload& payload)
+        {
+            // released once the lock is dropped, releasing a sink is an IPC call
+            std::vector<std::shared_ptr<Subscriber>> disconnected;
+            SequencedEvent event;
+
+            std::lock_guard<std::mutex> lock(_sequenceLock);
+
+            event.sequence = ++_sequence;
+            event.timestamp = Core::Time::Now().Ticks() / Core::Time::TicksPerMillisecond;
+            event.payload = payload;
+
+            _replay.Append(event);
+            const string key = stateKey(*payload);
+            if (!key.empty())
+            {
+                _stateEvents[key] = event;
+            }
+
+            if (payload->event == ON_AVDECODER_STATUSCHANGED)
+            {
+                queueEvent(_deviceDiagnosticsNotification, event, disconnected);
+            }
+            queueEvent(_deviceDiagnosticsExtNotification, event, disconnected);
+        }
+
+        /* Every subscriber gets the event in its own queue, and its own drain
+         * Job when none is running, so a slow subscriber only delays itself.
+         * Filters are applied here, an event filtered out is never queued.
+         * Subscribers dropped for not keeping up are handed back in disconnected */
+        void DeviceDiagnosticsImplementation::queueEvent(SubscriberList<Subscriber>& subscribers, const SequencedEvent& event, std::vector<std::shared_ptr<Subscriber>>& disconnected)
+        {
+            const uint64_t now = monotonicUs();
+            const auto list = subscribers.Get();
+            const EventData& data = *event.payload;
+            const uint8_t type = eventType(data.event);
+            const uint8_t state = eventState(data);
+            const string key = stateKey(data);
+
+            for (const std::shared_ptr<Subscriber>& subscriber : *list)
+            {
+                if (!subscriber->filter.Open())
+                {
+                    bool schedule = false;
+                    const SubscriberFilter<SequencedEvent>::Verdict verdict = subscriber->filter.Offer(event, type, state, key, now / 1000, schedule);
+                    if (schedule)
+                    {
+                        scheduleFlush(subscriber);
+                    }
+                    if (verdict != SubscriberFilter<SequencedEvent>::PASS)
+                    {
+                        continue;
+                    }
+                }
+
+                switch (subscriber->queue.Push(event, now))
+                {
+                    case EventQueue::START:
+                        Core::IWorkerPool::Instance().Submit(Job::Create(this, subscriber));
+                        break;
+
+                    case EventQueue::CLOSED:
+                        if (subscribers.Remove(subscriber->Sink()))
+                        {
+                            disconnected.push_back(subscriber);
+                            _disconnectedSubscribers++;
+                            LOGWARN("%s notification %u is not keeping up, disconnected", subscriber->interface, subscriber->id);
+                        }
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+        }
+
+        void DeviceDiagnosticsImplementation::scheduleFlush(const std::shared_ptr<Subscriber>& subscriber)
+        {
+            const uint64_t now = monotonicMs();
+            const uint64_t deadline = subscriber->filter.Deadline();
+            const uint64_t delay = (deadline > now ? deadline - now : 0);
+
+            Core::IWorkerPool::Instance().Schedule(Core::Time::Now().Add(static_cast<uint32_t>(delay)), Job::Create(this, subscriber, true));
+        }
+
+        /* Queues what the filter held back once its interval is over, under
+         * _sequenceLock so a newer event for the same state cannot overtake it */
+        void DeviceDiagnosticsImplementation::Flush(const std::shared_ptr<Subscriber>& subscriber)
+        {
+            std::vector<SequencedEvent> events;
+            bool drain = false;
+
+            _sequenceLock.lock();
+            if (subscriber->filter.Flush(monotonicMs(), events))
+            {
+                const uint64_t now = monotonicUs();
+                for (const SequencedEvent& event : events)
+                {
+                    drain = ((subscriber->queue.Push(event, now) == EventQueue::START) || drain);
+                }
+            }
+            else
+            {
+                // an event that passed in the meantime moved the interval on
+                scheduleFlush(subscriber);
+            }
+            _sequenceLock.unlock();
+
+            if (drain)
+            {
+                Dispatch(*subscriber);
+            }
+        }
+
+        /* Runs on a worker without a lock, one drain per subscriber at a time */
+        void DeviceDiagnosticsImplementation::Dispatch(Subscriber& subscriber)
+        {
+            SequencedEvent event;
+            uint64_t queued;
+
+            while (subscriber.queue.Pop(event, queued))
+            {
+                subscriber.Deliver(event);
+                subscriber.queue.Delivered(monotonicUs() - queued);
+            }
+        }
+
+        void DeviceDiagnosticsImplementation::Deliver(Exchange::IDeviceDiagnostics::INotification* notification, const SequencedEvent& event)
+        {
+            const EventData& data = *event.payload;
+
+            if (data.event == ON_AVDECODER_STATUSCHANGED)
+            {
+                notification->OnAVDecoderStatusChanged(data.text);
+            }
+            else
+            {
+                LOGWARN("Event[%u] not handled", data.event);
+            }
+        }
+
+        void DeviceDiagnosticsImplementation::Deliver(Exchange::IDeviceDiagnosticsExt::INotification* notification, const SequencedEvent& event)
+        {
+            const EventData& data = *event.payload;
+
+            switch(data.event)
+            {
+                case ON_AVDECODER_STATUSCHANGED:
+                    notification->OnAVDecoderStatus(data.status, event.sequence, event.timestamp);
+                    break;
+
+                case ON_CONFIGURATION_RESULT:
+                    notification->OnConfigurationResult(data.number, data.success, data.text, event.sequence, event.timestamp);
+                    break;
+
+                case ON_MILESTONE_LOGGED:
+                    notification->OnMilestoneLogged(data.text, event.sequence, event.timestamp);
+                    break;
+
+                case ON_DECODER_STATE_CHANGED:
+                    notification->OnDecoderStateChanged(data.type, data.number, data.status, event.sequence, data.timestamp);
+                    break;
+
+                default:
+                    LOGWARN("Event[%u] not handled", data.event);
+                    break;
+            }
+        }
+    
+        /* picks the decoder status source, enumerates its decoders and
+         * starts polling it. Without a source the status stays IDLE. */
+        void DeviceDiagnosticsImplementation::openDecoderStatusSource(const string& source, const string& trace, const uint32_t speed, const uint32_t repeat)
+        {
+            std::unique_ptr<DecoderStatusSource> decoderStatusSource;
+            SimulatedDecoderStatusSource* simulator = nullptr;
+
+            if (source == "simulator")
+            {
+                simulator = new SimulatedDecoderStatusSource(trace, speed, repeat, monotonicMs);
+                decoderStatusSource.reset(simulator);
+            }
+            else if (source == "erm")
+            {
+#ifdef ENABLE_ERM
+                decoderStatusSource.reset(new ErmDecoderStatusSource());
+#else
+                LOGWARN("ENABLE_ERM is not defined, decoder status will "
+                        "always be reported as IDLE");
+                return;
+#endif
+            }
+            else
+            {
+                LOGERR("Unknown decoder status source '%s', decoder status will always be reported as IDLE", source.c_str());
+                return;
+            }
+
+            if (!decoderStatusSource->Open())
+            {
+                if ((simulator != nullptr) && (simulator->ErrorLine() != 0))
+                {
+                    LOGERR("Decoder trace %s: line %u not understood", trace.c_str(), simulator->ErrorLine());
+                }
+                else
+                {
+                    LOGERR("Could not open the %s decoder status source", source.c_str());
+                }
+                return;
+            }
+
+            std::vector<DecoderStatusSource::Decoder> decoders;
+            decoderStatusSource->Decoders(decoders);
+
+            m_AVDecoderStatusLock.lock();
+            m_decoderStatusSource = std::move(decoderStatusSource);
+            // the decoder set is fixed for the device, enumerate it once
+            for (const DecoderStatusSource::Decoder& decoder : decoders)
+            {
+                m_decoders.push_back({ decoder.type, decoder.id, DecoderStatusSource::IDLE, 0 });
+            }
+            m_pollThreadRun = 1;
+            m_AVDecoderStatusLock.unlock();
+
+            // recorded for replay like the AV status, before any change can be seen
+            for (const DecoderStatusSource::Decoder& decoder : decoders)
+            {
+                std::shared_ptr<EventData> data = std::make_shared<EventData>();
+                data->event = ON_DECODER_STATE_CHANGED;
+                data->type = (decoder.type == DecoderStatusSource::VIDEO ? "video" : "audio");
+                data->number = decoder.id;
+                data->status = decoderStatusStr[DecoderStatusSource::IDLE];
+                data->timestamp = 0;
+                dispatchEvent(data);
+            }
+
+            if (simulator != nullptr)
+            {
+                LOGINFO("Replaying decoder trace %s at %u%% speed", trace.c_str(), speed);
+            }
+            LOGINFO("Tracking %zu decoders", decoders.size());
+
+            m_AVPollThread = std::thread(AVPollThread, this);
+        }
+
+        /* retrieves most active decoder status from the source,
+         * for ERM this library keeps state of all decoders and will
+         * give us only the most active status of any decoder.
+         * Called with m_AVDecoderStatusLock held. */
+        int DeviceDiagnosticsImplementation::getMostActiveDecoderStatus()
+        {
+            _decoderReads++;
+            return (m_decoderStatusSource ? m_decoderStatusSource->MostActive() : static_cast<int>(DecoderStatusSource::IDLE));
+        }
+
+        /* reads the status from the source now and publishes it for GetAVDecoderStatus.
+         * Callers that queue up behind a read started after they were called
+         * take its result instead of reading the source again. */
+        DeviceDiagnosticsImplementation::DecoderStatus DeviceDiagnosticsImplementation::queryDecoderStatus()
+        {
+            const uint32_t reads = _decoderReads.load();
+            std::lock_guard<std::mutex> lock(m_AVDecoderStatusLock);
+            if (_decoderReads.load() != reads)
+            {
+                return _decoderStatus.Load();
+            }
+            return publishDecoderStatus(getMostActiveDecoderStatus());
+        }
+
+        /* Called with m_AVDecoderStatusLock held, the lock the status was read
+         * under, so an RPC thread's read cannot overwrite a newer poll result */
+        DeviceDiagnosticsImplementation::DecoderStatus DeviceDiagnosticsImplementation::publishDecoderStatus(const int status)
+        {
+            DecoderStatus snapshot;
+            snapshot.status = status;
+            snapshot.timestamp = Core::Time::Now().Ticks() / Core::Time::TicksPerMillisecond;
+            _decoderStatus.Store(snapshot);
+            return snapshot;
+        }
+
+        /* periodically polls the decoder status source for changes
+         * in most active decoder and send thunder event when decoder
+         * status changes. Needs to be done via poll and separate
+         * thread because ERM doesn't support events. */
+        void *DeviceDiagnosticsImplementation::AVPollThread(void *arg)
+        {
+            int lastStatus = DecoderStatusSource::IDLE;
+            int status;
+            uint32_t interval = AVDECODERSTATUS_MIN_POLL_INTERVAL;
+
+            LOGINFO("AVPollThread started");
+            if (DeviceDiagnosticsImplementation::_instance != nullptr)
+            {
+                DeviceDiagnosticsImplementation::_instance->queryDecoderStatus();
+            }
+
+            for (;;)
+            {
+                // Coverity Fix: ATOMICITY - Read _instance inside lock to ensure atomic access
+                DeviceDiagnosticsImplementation* t = DeviceDiagnosticsImplementation::_instance;
+                if (!t) break; // Safety check in case instance is null
+
+                // Coverity Fix: ID 206, 207 - Double unlock: Use scope block to control lock lifetime
+                {
+                    std::unique_lock<std::mutex> lock(t->m_AVDecoderStatusLock);
+
+                    // Coverity Fix: ID 1 - Data race: Use wait_for with predicate to handle spurious wakeups
+                    // Wait for signal or timeout, checking m_pollThreadRun in a loop
+                    t->m_avDecoderStatusCv.wait_for(lock, std::chrono::milliseconds(interval),
+                        [t]() { return t->m_pollThreadRun == 0; });
+
+                    if (t->m_pollThreadRun == 0)
+                        break;
+
+                    status = t->getMostActiveDecoderStatus();
+                    // readers see the new status before the change event goes out
+                    t->publishDecoderStatus(status);
+                    t->pollDecoderStates();
+                } // Lock automatically released here
+
+                // fast right after a change and while decoding, backing off while idle
+                interval = t->_decoderPollScheduler.Polled(status);
+
+                const uint64_t now = monotonicMs();
+                if (status != lastStatus)
+                {
+                    t->_decoderHistory.Record(status, now);
+                    lastStatus = status;
+                    t->_decoderEventDebouncer.Changed(status, now);
+                }
+
+                // flapping inside the debounce window goes out as one event, or none
+                int eventStatus;
+                if (t->_decoderEventDebouncer.Due(now, eventStatus))
+                {
+                    t->onDecoderStatusChange(eventStatus);
+                }
+
+                // wake up when the window closes even if the poll interval is longer
+                const uint64_t deadline = t->_decoderEventDebouncer.Deadline();
+                if ((deadline != 0) && (deadline - now < interval))
+                {
+                    interval = static_cast<uint32_t>(deadline - now);
+                }
+            }
+
+            return NULL;
+        }
+
+        /* called from the poll pass with m_AVDecoderStatusLock held, one
+         * state query per decoder on top of the most active status */
+        void DeviceDiagnosticsImplementation::pollDecoderStates()
+        {
+            for (Decoder& decoder : m_decoders)
+            {
+                int state = DecoderStatusSource::IDLE;
+                if (!m_decoderStatusSource->DecoderState(decoder.type, decoder.id, state))
+                {
+                    continue;
+                }
+                if (state == decoder.status)
+                {
+                    continue;
+                }
+
+                decoder.status = state;
+                decoder.lastTransition = Core::Time::Now().Ticks() / Core::Time::TicksPerMillisecond;
+
+                std::shared_ptr<EventData> data = std::make_shared<EventData>();
+                data->event = ON_DECODER_STATE_CHANGED;
+                data->type = (decoder.type == DecoderStatusSource::VIDEO ? "video" : "audio");
+                data->number = decoder.id;
+                data->status = decoderStatusStr[state];
+                data->timestamp = decoder.lastTransition;
+                dispatchEvent(data);
+            }
+        }
+
+        void DeviceDiagnosticsImplementation::onDecoderStatusChange(int status)
+        {
+            // only three payloads exist, each serialized once for the lifetime of the plugin
+            static const EventPayload payloads[] = {
+                avDecoderStatusPayload(0),
+                avDecoderStatusPayload(1),
+                avDecoderStatusPayload(2)
+            };
+            dispatchEvent(payloads[status]);
+        }
+
+        Core::hresult DeviceDiagnosticsImplementation::GetConfiguration(IStringIterator* const& names, Exchange::IDeviceDiagnostics::IDeviceDiagnosticsParamListIterator*& paramList, bool& success)
+        {
+            CallMetrics::Call call(_apiMetrics[API_GET_CONFIGURATION]);
+	    LOGINFO("");
+
+            std::list<string> requested;
+            std::list<string> missing;
+            std::map<string, string> cached;
+            std::list<ParamList> deviceDiagnosticsList;
+
+            lookupConfiguration(names, requested, cached, missing);
+            LOGTRACE("names=%s", stringListJson(requested).c_str());
+
+            SingleFlight<ConfigurationResult>::Result fetched;
+            if (!missing.empty())
+            {
+                // Identical name sets in flight share one backend round-trip
+                std::set<string> canonical(missing.begin(), missing.end());
+                string key;
+                for (const string& name : canonical)
+                {
+                    key += name;
+                    key += '\n';
+                }
+
+                bool coalesced = false;
+                fetched = _configurationRequests.Run(key, [this, &missing]() { return fetchConfiguration(missing); }, coalesced);
+                if (coalesced)
+                {
+                    LOGINFO("Coalesced with an identical request in flight");
+                }
+
+                if (fetched->status != 0)
+                {
+                    success = false;
+                    return call.Result(Core::ERROR_GENERAL);
+                }
+            }
+
+            mergeConfiguration(requested, cached, (fetched ? &fetched->params : nullptr), deviceDiagnosticsList);
+            LOGTRACE("paramList=%s", paramListJson(deviceDiagnosticsList).c_str());
+
+            paramList = Core::Service<RPC::IteratorType<Exchange::IDeviceDiagnostics::IDeviceDiagnosticsParamListIterator>> \
+				::Create<Exchange::IDeviceDiagnostics::IDeviceDiagnosticsParamListIterator>(deviceDiagnosticsList);
+            success = true;
+            return call.Result(Core::ERROR_NONE);
+        }
+
+        Core::hresult DeviceDiagnosticsImplementation::GetConfigurationAsync(RPC::IStringIterator* const& names, uint32_t& requestId)
+        {
+            LOGINFO("");
+
+            std::shared_ptr<AsyncConfigurationRequest> request = std::make_shared<AsyncConfigurationRequest>();
+            std::list<string> missing;
+
+            lookupConfiguration(names, request->requested, request->cached, missing);
+            request->id = _nextRequestId++;
+            LOGTRACE("requestId=%u names=%s", request->id, stringListJson(request->requested).c_str());
+
+            if (missing.empty())
+            {
+                // emitted from a worker like a backend result, never from
+                // within this call ahead of the requestId it returns
+                std::list<ParamList> deviceDiagnosticsList;
+                mergeConfiguration(request->requested, request->cached, nullptr, deviceDiagnosticsList);
+                Core::IWorkerPool::Instance().Submit(Job::Create(this, configurationResultPayload(request->id, true, deviceDiagnosticsList)));
+                requestId = request->id;
+                return Core::ERROR_NONE;
+            }
+
+            CURL *curl_handle = curl_easy_init();
+            if (curl_handle == nullptr)
+            {
+                LOGERR("Could not create curl handle");
+                return Core::ERROR_GENERAL;
+            }
+
+            request->generation = _parameterCache.Generation();
+            request->postData = configurationRequest(missing);
+            LOGINFO("request %u data: %s", request->id, request->postData.c_str());
+            prepareConfigRequest(curl_handle, request->postData, request->parser);
+
+            bool submitted = _asyncEngine.Submit(request->id, curl_handle, [this, request](const CURLcode res, const long http_code) {
+                const bool success = ((res == CURLE_OK) && ((http_code == 0) || (http_code == 200)) &&
+                    (!request->parser.HasError()) && (!request->parser.IsTruncated()));
+                std::list<ParamList> deviceDiagnosticsList;
+
+                LOGINFO("request %u completed: %d http response code: %ld, %u parameters%s", request->id, res, http_code, request->parser.Entries(),
+                    (request->parser.HasError() ? ", malformed" : (request->parser.IsTruncated() ? ", truncated" : "")));
+
+                if (success)
+                {
+                    for (const ParamList& param : request->received)
+                    {
+                        _parameterCache.Store(param.name, param.value, request->generation);
+                    }
+                    mergeConfiguration(request->requested, request->cached, &request->received, deviceDiagnosticsList);
+                }
+                onConfigurationResult(request->id, success, deviceDiagnosticsList);
+            });
+
+            if (!submitted)
+            {
+                LOGERR("Could not queue request %u", request->id);
+                return Core::ERROR_GENERAL;
+            }
+
+            requestId = request->id;
+            return Core::ERROR_NONE;
+        }
+
+        void DeviceDiagnosticsImplementation::onConfigurationResult(const uint32_t requestId, const bool success, const std::list<ParamList>& paramListInfo)
+        {
+            dispatchEvent(configurationResultPayload(requestId, success, paramListInfo));
+        }
+
+        void DeviceDiagnosticsImplementation::onMilestoneLogged(const std::list<string>& milestones)
+        {
+            std::shared_ptr<EventData> data = std::make_shared<EventData>();
+
+            data->event = ON_MILESTONE_LOGGED;
+            data->text = stringListJson(milestones);
+
+            dispatchEvent(data);
+        }
+
+        Core::hresult DeviceDiagnosticsImplementation::GetMilestones(IStringIterator*& milestones, bool& success)
+        {
+            CallMetrics::Call call(_apiMetrics[API_GET_MILESTONES]);
+            uint32_t result = Core::ERROR_NONE;
+            bool retAPIStatus = false;
+	    std::list<string> list;
+
+            LOGINFO("");
+
+            if (Core::File(string(MILESTONES_LOG_FILE)).Exists())
+            {
+                retAPIStatus = _milestoneReader.Read(list);
+                if (!retAPIStatus)
+                {
+                    LOGERR("File access failed");
+                    success = false;
+                    result = Core::ERROR_GENERAL;
+                }
+            }
+            else 
+            {
+                LOGERR("Expected file not found");
+                success = false;
+                result = Core::ERROR_GENERAL;
+            }
+
+            if (result == Core::ERROR_NONE)
+            {
+                LOGTRACE("milestones=%s", stringListJson(list).c_str());
+                milestones = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(list));
+                success = true;
+            }
+
+            return call.Result(result);
+        }
+
+        Core::hresult DeviceDiagnosticsImplementation::QueryMilestones(const uint64_t since, const uint64_t until, const string& prefix, const string& contains,
+            const uint32_t offset, const uint32_t limit, RPC::IStringIterator*& milestones, uint32_t& total)
         {
-            LOGINFO("Create DeviceDiagnosticsImplementation Instance");
+            MilestoneReader::Filter filter;
+            std::list<string> list;
 
-            DeviceDiagnosticsImplementation::_instance = this;
+            LOGINFO("since: %llu until: %llu offset: %u limit: %u", static_cast<unsigned long long>(since), static_cast<unsigned long long>(until), offset, limit);
 
-#ifdef ENABLE_ERM
+            if (!Core::File(string(MILESTONES_LOG_FILE)).Exists())
+            {
+                LOGERR("Expected file not found");
+                return Core::ERROR_GENERAL;
+            }
 
-            if ((m_EssRMgr = EssRMgrCreate()) == NULL)
+            filter.since = since;
+            filter.until = until;
+            filter.prefix = prefix;
+            filter.contains = contains;
+
+            if (!_milestoneReader.Query(filter, offset, limit, list, total))
             {
-                LOGERR("EssRMgrCreate() failed");
-                return;
+                LOGERR("File access failed");
+                return Core::ERROR_GENERAL;
             }
 
-            m_pollThreadRun = 1;
-            m_AVPollThread = std::thread(AVPollThread, this);
-#else
-            LOGWARN("ENABLE_ERM is not defined, decoder status will "
-                    "always be reported as IDLE");
-#endif
+            milestones = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(list));
+            return Core::ERROR_NONE;
         }
 
-        DeviceDiagnosticsImplementation::~DeviceDiagnosticsImplementation()
+        Core::hresult DeviceDiagnosticsImplementation::LogMilestone(const string& marker, bool& success)
         {
-#ifdef ENABLE_ERM
-            m_AVDecoderStatusLock.lock();
-            m_pollThreadRun = 0;
-            m_AVDecoderStatusLock.unlock();
-            m_avDecoderStatusCv.notify_one();
-			if (m_AVPollThread.joinable())
-			{
-                m_AVPollThread.join();
-			}
-            EssRMgrDestroy(m_EssRMgr);
-#endif
-            DeviceDiagnosticsImplementation::_instance = nullptr;
-            _service = nullptr;
+            CallMetrics::Call call(_apiMetrics[API_LOG_MILESTONE]);
+	    LOGINFO("");
+            LOGTRACE("marker=%s", marker.c_str());
+            if (marker.empty())
+            {
+                LOGERR("Empty marker' parameter");
+                success = false;
+                return call.Result(Core::ERROR_GENERAL);
+            }
+
+            if (!_milestoneLogger.Log(marker))
+            {
+                LOGERR("Milestone queue full, dropping marker");
+                success = false;
+                return call.Result(Core::ERROR_GENERAL);
+            }
+            success = true;
+            return call.Result(Core::ERROR_NONE); 
+
         }
 
-        Core::hresult DeviceDiagnosticsImplementation::Register(Exchange::IDeviceDiagnostics::INotification *notification)
+        Core::hresult DeviceDiagnosticsImplementation::LogMilestones(RPC::IStringIterator* const& markers, bool& success)
         {
-            ASSERT (nullptr != notification);
+            std::list<string> list;
+            string marker;
 
-            _adminLock.Lock();
+            LOGINFO("");
+            success = false;
 
-            // Make sure we can't register the same notification callback multiple times
-            if (std::find(_deviceDiagnosticsNotification.begin(), _deviceDiagnosticsNotification.end(), notification) == _deviceDiagnosticsNotification.end())
+            if (markers == nullptr)
             {
-                _deviceDiagnosticsNotification.push_back(notification);
-                notification->AddRef();
+                LOGERR("Missing markers parameter");
+                return Core::ERROR_GENERAL;
             }
-            else
+
+            while (markers->Next(marker) == true)
             {
-                LOGERR("same notification is registered already");
+                if (marker.empty())
+                {
+                    LOGERR("Empty marker in markers parameter");
+                    return Core::ERROR_GENERAL;
+                }
+                list.push_back(marker);
             }
 
-            _adminLock.Unlock();
+            const size_t count = list.size();
+            if (!_milestoneLogger.Log(list))
+            {
+                LOGERR("Milestone queue full, dropping %zu markers", count);
+                return Core::ERROR_GENERAL;
+            }
 
+            success = true;
             return Core::ERROR_NONE;
         }
 
-        Core::hresult DeviceDiagnosticsImplementation::Unregister(Exchange::IDeviceDiagnostics::INotification *notification )
+        Core::hresult DeviceDiagnosticsImplementation::GetDecoderPollStatistics(IDecoderPollModeIterator*& modes, uint32_t& interval)
         {
-            Core::hresult status = Core::ERROR_GENERAL;
-
-            ASSERT (nullptr != notification);
-
-            _adminLock.Lock();
+            std::list<DecoderPollMode> list;
 
-            // we just unregister one notification once
-            auto itr = std::find(_deviceDiagnosticsNotification.begin(), _deviceDiagnosticsNotification.end(), notification);
-            if (itr != _deviceDiagnosticsNotification.end())
+            for (int mode = 0; mode < DecoderPollScheduler::Modes; mode++)
             {
-                (*itr)->Release();
-                _deviceDiagnosticsNotification.erase(itr);
-                status = Core::ERROR_NONE;
-            }
-            else
-            {
-                LOGERR("notification not found");
+                const DecoderPollScheduler::Statistics statistics = _decoderPollScheduler.Get(mode);
+                DecoderPollMode entry;
+
+                entry.mode = decoderStatusStr[mode];
+                entry.wakeups = statistics.wakeups;
+                entry.wakeupsPerHour = ((statistics.time > 0) ? static_cast<uint32_t>((statistics.wakeups * 3600000ull) / statistics.time) : 0);
+                entry.transitions = statistics.transitions;
+                entry.averageLatencyMs = ((statistics.transitions > 0) ? static_cast<uint32_t>(statistics.latency / statistics.transitions) : 0);
+                entry.maxLatencyMs = statistics.maxLatency;
+                list.push_back(entry);
             }
 
-            _adminLock.Unlock();
-
-            return status;
+            modes = Core::Service<RPC::IteratorType<IDecoderPollModeIterator>>::Create<IDecoderPollModeIterator>(list);
+            interval = _decoderPollScheduler.Interval();
+            return Core::ERROR_NONE;
         }
 
-        void DeviceDiagnosticsImplementation::dispatchEvent(Event event, const JsonValue &params)
+        Core::hresult DeviceDiagnosticsImplementation::GetAVDecoderStatus(AvDecoderStatusResult& AVDecoderStatus)
         {
-            Core::IWorkerPool::Instance().Submit(Job::Create(this, event, params));
+            CallMetrics::Call call(_apiMetrics[API_GET_AV_DECODER_STATUS]);
+            LOGINFO("");
+
+            // the poll thread keeps this within avpoll.maxinterval
+            DecoderStatus snapshot = _decoderStatus.Load();
+            if (snapshot.timestamp == 0)
+            {
+                snapshot = queryDecoderStatus();
+            }
+            AVDecoderStatus.avDecoderStatus = decoderStatusStr[snapshot.status];
+            LOGTRACE("avDecoderStatus=%s", AVDecoderStatus.avDecoderStatus.c_str());
+            return call.Result(Core::ERROR_NONE);
         }
 
-        void DeviceDiagnosticsImplementation::Dispatch(Event event, const JsonValue params)
+        Core::hresult DeviceDiagnosticsImplementation::GetAVDecoderStatusSnapshot(const bool fresh, AVDecoderStatusSnapshot& snapshot)
         {
-            _adminLock.Lock();
-        
-            std::list<Exchange::IDeviceDiagnostics::INotification*>::const_iterator index(_deviceDiagnosticsNotification.begin());
-        
-            switch(event)
+            DecoderStatus status = _decoderStatus.Load();
+            if ((fresh == true) || (status.timestamp == 0))
             {
-                case ON_AVDECODER_STATUSCHANGED:
-                    while (index != _deviceDiagnosticsNotification.end()) 
-                    {
-                        (*index)->OnAVDecoderStatusChanged(params.String());
-                        ++index;
-                    }
-                    break;
- 
-                default:
-                    LOGWARN("Event[%u] not handled", event);
-                    break;
+                status = queryDecoderStatus();
             }
-            _adminLock.Unlock();
+            snapshot.avDecoderStatus = decoderStatusStr[status.status];
+            snapshot.timestamp = status.timestamp;
+            return Core::ERROR_NONE;
         }
-    
-        /* retrieves most active decoder status from ERM library,
-         * this library keeps state of all decoders and will give
-         * us only the most active status of any decoder */
-        int DeviceDiagnosticsImplementation::getMostActiveDecoderStatus()
+
+        Core::hresult DeviceDiagnosticsImplementation::GetDecoderStates(IDecoderStateIterator*& decoders)
         {
-            int status = 0;
-#ifdef ENABLE_ERM
-            EssRMgrGetAVState(m_EssRMgr, &status);
-#endif
-            return status;
+            std::list<DecoderState> list;
+
+            m_AVDecoderStatusLock.lock();
+            for (const Decoder& decoder : m_decoders)
+            {
+                DecoderState entry;
+                entry.type = (decoder.type == DecoderStatusSource::VIDEO ? "video" : "audio");
+                entry.id = decoder.id;
+                entry.status = decoderStatusStr[decoder.status];
+                entry.lastTransition = decoder.lastTransition;
+                list.push_back(entry);
+            }
+            m_AVDecoderStatusLock.unlock();
+
+            decoders = Core::Service<RPC::IteratorType<IDecoderStateIterator>>::Create<IDecoderStateIterator>(list);
+            return Core::ERROR_NONE;
         }
 
-        /* periodically polls ERM library for changes in most
-         * active decoder and send thunder event when decoder
-         * status changes. Needs to be done via poll and separate
-         * thread because ERM doesn't support events. */
-#ifdef ENABLE_ERM
-        void *DeviceDiagnosticsImplementation::AVPollThread(void *arg)
+        Core::hresult DeviceDiagnosticsImplementation::GetDecoderHistory(const uint32_t window, IDecoderStateHistoryIterator*& states, uint64_t& coveredMs, uint32_t& transitions)
         {
-            int lastStatus = EssRMgrRes_idle;
-            int status;
-            int timeoutInSec = AVDECODERSTATUS_RETRY_INTERVAL;
+            DecoderHistory::Statistics statistics[DecoderHistory::States];
+            std::list<DecoderStateHistory> list;
 
-            LOGINFO("AVPollThread started");
-            for (;;)
+            _decoderHistory.Get(static_cast<uint64_t>(window) * 1000, monotonicMs(), statistics, coveredMs, transitions);
+
+            for (int state = 0; state < DecoderHistory::States; state++)
             {
-                // Coverity Fix: ATOMICITY - Read _instance inside lock to ensure atomic access
-                DeviceDiagnosticsImplementation* t = DeviceDiagnosticsImplementation::_instance;
-                if (!t) break; // Safety check in case instance is null
+                DecoderStateHistory entry;
+                entry.status = decoderStatusStr[state];
+                entry.timeMs = statistics[state].time;
+                entry.dutyCycle = ((coveredMs > 0) ? static_cast<uint32_t>((statistics[state].time * 10000) / coveredMs) : 0);
+                entry.episodes = statistics[state].episodes;
+                entry.p50Ms = statistics[state].p50;
+                entry.p90Ms = statistics[state].p90;
+                entry.p99Ms = statistics[state].p99;
+                entry.maxMs = statistics[state].max;
+                list.push_back(entry);
+            }
 
-                // Coverity Fix: ID 206, 207 - Double unlock: Use scope block to control lock lifetime
-                {
-                    std::unique_lock<std::mutex> lock(t->m_AVDecoderStatusLock);
+            states = Core::Service<RPC::IteratorType<IDecoderStateHistoryIterator>>::Create<IDecoderStateHistoryIterator>(list);
+            return Core::ERROR_NONE;
+        }
 
-                    // Coverity Fix: ID 1 - Data race: Use wait_for with predicate to handle spurious wakeups
-                    // Wait for signal or timeout, checking m_pollThreadRun in a loop
-                    t->m_avDecoderStatusCv.wait_for(lock, std::chrono::seconds(timeoutInSec),
-                        [t]() { return t->m_pollThreadRun == 0; });
+        Core::hresult DeviceDiagnosticsImplementation::GetDecoderEventStatistics(uint32_t& sent, uint32_t& suppressed)
+        {
+            sent = _decoderEventDebouncer.Sent();
+            suppressed = _decoderEventDebouncer.Suppressed();
+            return Core::ERROR_NONE;
+        }
 
-                    if (t->m_pollThreadRun == 0)
-                        break;
+        Core::hresult DeviceDiagnosticsImplementation::GetMetrics(const bool reset, IMethodMetricsIterator*& methods)
+        {
+            static const char* const names[API_COUNT] = {
+                "register",
+                "unregister",
+                "getConfiguration",
+                "getMilestones",
+                "logMilestone",
+                "getAVDecoderStatus"
+            };
+            std::list<MethodMetrics> list;
+
+            for (uint32_t api = 0; api < API_COUNT; api++)
+            {
+                const CallMetrics::Summary summary = _apiMetrics[api].Get();
+                MethodMetrics entry;
+
+                entry.method = names[api];
+                entry.calls = summary.calls;
+                entry.errors = summary.errors;
+                entry.inFlight = summary.inFlight;
+                entry.averageUs = (summary.latency.count > 0 ? static_cast<uint32_t>(summary.latency.sum / summary.latency.count) : 0);
+                entry.p50Us = summary.latency.p50;
+                entry.p90Us = summary.latency.p90;
+                entry.p99Us = summary.latency.p99;
+                entry.maxUs = summary.latency.max;
+                list.push_back(entry);
+
+                if (reset)
+                {
+                    _apiMetrics[api].Reset();
+                }
+            }
 
-                    status = t->getMostActiveDecoderStatus();
-                } // Lock automatically released here
+            methods = Core::Service<RPC::IteratorType<IMethodMetricsIterator>>::Create<IMethodMetricsIterator>(list);
+            return Core::ERROR_NONE;
+        }
 
-                if (status == lastStatus)
-                    continue;
+        Core::hresult DeviceDiagnosticsImplementation::SetMethodTrace(const string& method, const bool enabled)
+        {
+            LOGINFO("method: %s enabled: %d", method.c_str(), enabled);
 
-                lastStatus = status;
-                t->onDecoderStatusChange(status);
+            if (method.empty())
+            {
+                LOGERR("Empty method parameter");
+                return Core::ERROR_GENERAL;
             }
 
-            return NULL;
+            Utils::Logging::MethodTrace::Instance().Set(method, enabled);
+            return Core::ERROR_NONE;
         }
-#endif
 
-        void DeviceDiagnosticsImplementation::onDecoderStatusChange(int status)
+        Core::hresult DeviceDiagnosticsImplementation::GetMethodTrace(RPC::IStringIterator*& methods)
         {
-            JsonObject params;
-            params["avDecoderStatusChange"] = decoderStatusStr[status];
-            dispatchEvent(ON_AVDECODER_STATUSCHANGED, params);
+            const std::list<string> list = Utils::Logging::MethodTrace::Instance().Methods();
+
+            methods = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(list));
+            return Core::ERROR_NONE;
         }
 
-        Core::hresult DeviceDiagnosticsImplementation::GetConfiguration(IStringIterator* const& names, Exchange::IDeviceDiagnostics::IDeviceDiagnosticsParamListIterator*& paramList, bool& success)
+        Core::hresult DeviceDiagnosticsImplementation::GetSubscriberStatistics(ISubscriberStatisticsIterator*& subscribers, uint32_t& disconnected)
         {
-	    LOGINFO("");
-
-	    std::string entry;
-            JsonObject requestParams;
-            JsonArray namePairs;
-            std::list<ParamList> deviceDiagnosticsList;
+            std::list<SubscriberStatistics> list;
 
-            while (names->Next(entry) == true)
+            for (SubscriberList<Subscriber>* registered : { &_deviceDiagnosticsNotification, &_deviceDiagnosticsExtNotification })
             {
-	        JsonObject o;
-                o["name"] = entry;
-                namePairs.Add(o);
-	    }
+                const auto entries = registered->Get();
+                for (const auto& subscriber : *entries)
+                {
+                    const EventQueue::Statistics queue = subscriber->queue.Get();
+                    SubscriberStatistics entry;
+
+                    entry.id = subscriber->id;
+                    entry.interface = subscriber->interface;
+                    entry.queued = queue.queued;
+                    entry.maxQueued = queue.maxQueued;
+                    entry.delivered = queue.delivered;
+                    entry.dropped = queue.dropped;
+                    entry.coalesced = queue.coalesced;
+                    entry.filtered = subscriber->filter.Filtered();
+                    entry.averageLatencyUs = (queue.delivered > 0 ? static_cast<uint32_t>(queue.latency / queue.delivered) : 0);
+                    entry.maxLatencyUs = queue.maxLatency;
+                    list.push_back(entry);
+                }
+            }
+            list.sort([](const SubscriberStatistics& a, const SubscriberStatistics& b) { return (a.id < b.id); });
 
-            requestParams["paramList"] = namePairs;
-	    string json;
-            requestParams.ToString(json);
+            subscribers = Core::Service<RPC::IteratorType<ISubscriberStatisticsIterator>>::Create<ISubscriberStatisticsIterator>(list);
+            disconnected = _disconnectedSubscribers;
+            return Core::ERROR_NONE;
+        }
 
-            if (0 == getConfig(json, deviceDiagnosticsList))
-            {
-                paramList = Core::Service<RPC::IteratorType<Exchange::IDeviceDiagnostics::IDeviceDiagnosticsParamListIterator>> \
-				::Create<Exchange::IDeviceDiagnostics::IDeviceDiagnosticsParamListIterator>(deviceDiagnosticsList);
-                success = true;
-                return Core::ERROR_NONE;
-            }
+        Core::hresult DeviceDiagnosticsImplementation::GetConfigurationStatistics(ConfigurationStatistics& statistics)
+        {
+            CurlHandlePool::Statistics pool = _curlHandlePool.GetStatistics();
 
-            success = false;
-            return Core::ERROR_GENERAL;
+            statistics.requests = pool.requests;
+            statistics.reusedConnections = pool.reusedConnections;
+            statistics.newConnections = pool.newConnections;
+            statistics.waitTimeUs = pool.waitTimeUs;
+
+            ParameterCache::Statistics cache = _parameterCache.GetStatistics();
+
+            statistics.cacheHits = cache.hits;
+            statistics.cacheMisses = cache.misses;
+            statistics.coalescedCalls = _configurationRequests.Coalesced();
+
+            return Core::ERROR_NONE;
         }
 
-        Core::hresult DeviceDiagnosticsImplementation::GetMilestones(IStringIterator*& milestones, bool& success)
+        Core::hresult DeviceDiagnosticsImplementation::InvalidateConfigurationCache(const string& name, uint32_t& invalidated)
         {
-            uint32_t result = Core::ERROR_NONE;
-            bool retAPIStatus = false;
-	    std::list<string> list;
+            LOGINFO("name: %s", name.empty() ? "<all>" : name.c_str());
 
-            LOGINFO("");
+            invalidated = _parameterCache.Invalidate(name);
 
-            if (Core::File(string(MILESTONES_LOG_FILE)).Exists())
+            return Core::ERROR_NONE;
+        }
+
+        /* Splits the requested names into values still valid in the cache and
+         * the names that have to go to the backend, the latter de-duplicated */
+        void DeviceDiagnosticsImplementation::lookupConfiguration(RPC::IStringIterator* names, std::list<string>& requested, std::map<string, string>& cached, std::list<string>& missing)
+        {
+            std::set<string> queued;
+            string entry;
+
+            while (names->Next(entry) == true)
             {
-                retAPIStatus = getFileContent(MILESTONES_LOG_FILE, list);
-                if (!retAPIStatus)
+                string value;
+                requested.push_back(entry);
+
+                if (cached.find(entry) != cached.end())
                 {
-                    LOGERR("File access failed");
-                    success = false;
-                    result = Core::ERROR_GENERAL;
+                    continue;
+                }
+                if (_parameterCache.Lookup(entry, value))
+                {
+                    cached[entry] = value;
+                    continue;
+                }
+                if (queued.insert(entry).second)
+                {
+                    missing.push_back(entry);
                 }
             }
-            else 
-            {
-                LOGERR("Expected file not found");
-                success = false;
-                result = Core::ERROR_GENERAL;
-            }
+        }
 
-            if (result == Core::ERROR_NONE)
+        DeviceDiagnosticsImplementation::ConfigurationResult DeviceDiagnosticsImplementation::fetchConfiguration(const std::list<string>& names)
+        {
+            ConfigurationResult result;
+            const uint32_t generation = _parameterCache.Generation();
+
+            result.status = getConfig(configurationRequest(names), result.params);
+            if (result.status == 0)
             {
-                milestones = (Core::Service<RPC::StringIterator>::Create<RPC::IStringIterator>(list));
-                success = true;
+                for (const ParamList& param : result.params)
+                {
+                    _parameterCache.Store(param.name, param.value, generation);
+                }
             }
-
             return result;
         }
 
-        Core::hresult DeviceDiagnosticsImplementation::LogMilestone(const string& marker, bool& success)
+        void DeviceDiagnosticsImplementation::prepareConfigRequest(CURL *curl_handle, const std::string& postData, ParamListParser& parser)
         {
-	    LOGINFO("");
-            if (marker.empty())
-            {
-                LOGERR("Empty marker' parameter");
-                success = false;
-                return Core::ERROR_GENERAL;
-            }
-
-#ifdef RDK_LOG_MILESTONE
-            logMilestone(marker.c_str());
-#endif
-            success = true;
-            return Core::ERROR_NONE; 
-
+            if(curl_easy_setopt(curl_handle, CURLOPT_URL, _backendUrl.c_str()) != CURLE_OK)
+                LOGWARN("Failed to set curl option: CURLOPT_URL");
+            // a local backend can be reached over a unix domain socket, the url then only supplies path and Host header
+            if(!_backendSocket.empty() && curl_easy_setopt(curl_handle, CURLOPT_UNIX_SOCKET_PATH, _backendSocket.c_str()) != CURLE_OK)
+                LOGWARN("Failed to set curl option: CURLOPT_UNIX_SOCKET_PATH");
+            if(curl_easy_setopt(curl_handle, CURLOPT_POSTFIELDS, postData.c_str()) != CURLE_OK)
+                LOGWARN("Failed to set curl option: CURLOPT_POSTFIELDS");
+            if(curl_easy_setopt(curl_handle, CURLOPT_POSTFIELDSIZE, postData.size()) != CURLE_OK)
+                LOGWARN("Failed to set curl option: CURLOPT_POSTFIELDSIZE");
+            if(curl_easy_setopt(curl_handle, CURLOPT_FOLLOWLOCATION, 1) != CURLE_OK) //when redirected, follow the redirections
+                LOGWARN("Failed to set curl option: CURLOPT_FOLLOWLOCATION");
+            if(curl_easy_setopt(curl_handle, CURLOPT_WRITEFUNCTION, writeCurlResponse) != CURLE_OK)
+                LOGWARN("Failed to set curl option: CURLOPT_WRITEFUNCTION");
+            if(curl_easy_setopt(curl_handle, CURLOPT_WRITEDATA, &parser) != CURLE_OK)
+                LOGWARN("Failed to set curl option: CURLOPT_WRITEDATA");
+            if(curl_easy_setopt(curl_handle, CURLOPT_TIMEOUT, curlTimeoutInSeconds) != CURLE_OK)
+                LOGWARN("Failed to set curl option: CURLOPT_TIMEOUT");
         }
 
-        Core::hresult DeviceDiagnosticsImplementation::GetAVDecoderStatus(AvDecoderStatusResult& AVDecoderStatus)
+        /* Orders the result as the names were requested, cached values in place,
+         * anything the backend returned without being asked for goes last */
+        void DeviceDiagnosticsImplementation::mergeConfiguration(const std::list<string>& requested, const std::map<string, string>& cached, const std::list<ParamList>* fetched, std::list<ParamList>& paramListInfo)
         {
-            LOGINFO("");
-#ifdef ENABLE_ERM
-            m_AVDecoderStatusLock.lock();
-            int status = getMostActiveDecoderStatus();
-            m_AVDecoderStatusLock.unlock();
-            AVDecoderStatus.avDecoderStatus = decoderStatusStr[status];
-#else
-            AVDecoderStatus.avDecoderStatus = decoderStatusStr[0];
-#endif
-            return Core::ERROR_NONE;
+            std::set<string> listed;
+
+            for (const string& name : requested)
+            {
+                auto hit = cached.find(name);
+                if (hit != cached.end())
+                {
+                    ParamList param;
+                    param.name = hit->first;
+                    param.value = hit->second;
+                    paramListInfo.push_back(param);
+                    continue;
+                }
+
+                if (fetched != nullptr)
+                {
+                    auto param = std::find_if(fetched->begin(), fetched->end(),
+                        [&name](const ParamList& candidate) { return candidate.name == name; });
+                    if (param != fetched->end())
+                    {
+                        paramListInfo.push_back(*param);
+                        listed.insert(name);
+                    }
+                }
+            }
+
+            if (fetched != nullptr)
+            {
+                for (const ParamList& param : *fetched)
+                {
+                    if (listed.find(param.name) == listed.end())
+                    {
+                        paramListInfo.push_back(param);
+                    }
+                }
+            }
         }
 
         int DeviceDiagnosticsImplementation::getConfig(const std::string& postData, std::list<ParamList>& paramListInfo)
@@ -344,87 +1768,49 @@ namespace WPEFramework
             int result = -1;
 
             long http_code = 0;
-            std::string response;
-            CURL *curl_handle = NULL;
+            std::list<ParamList> received;
+            ParamListParser parser([&received](std::string& name, std::string& value) {
+                received.emplace_back();
+                received.back().name = std::move(name);
+                received.back().value = std::move(value);
+            });
             CURLcode res = CURLE_OK;
-            curl_handle = curl_easy_init();
+            CurlHandlePool::Lease lease(_curlHandlePool);
+            CURL *curl_handle = lease.Handle();
 
             LOGINFO("data: %s", postData.c_str());
 
             if (curl_handle)
             {
-                if(curl_easy_setopt(curl_handle, CURLOPT_URL, "http://127.0.0.1:10999") != CURLE_OK)
-                    LOGWARN("Failed to set curl option: CURLOPT_URL");
-                if(curl_easy_setopt(curl_handle, CURLOPT_POSTFIELDS, postData.c_str()) != CURLE_OK)
-                    LOGWARN("Failed to set curl option: CURLOPT_POSTFIELDS");
-                if(curl_easy_setopt(curl_handle, CURLOPT_POSTFIELDSIZE, postData.size()) != CURLE_OK)
-                    LOGWARN("Failed to set curl option: CURLOPT_POSTFIELDSIZE");
-                if(curl_easy_setopt(curl_handle, CURLOPT_FOLLOWLOCATION, 1) != CURLE_OK) //when redirected, follow the redirections
-                    LOGWARN("Failed to set curl option: CURLOPT_FOLLOWLOCATION");
-                if(curl_easy_setopt(curl_handle, CURLOPT_WRITEFUNCTION, writeCurlResponse) != CURLE_OK)
-                    LOGWARN("Failed to set curl option: CURLOPT_WRITEFUNCTION");
-                if(curl_easy_setopt(curl_handle, CURLOPT_WRITEDATA, &response) != CURLE_OK)
-                    LOGWARN("Failed to set curl option: CURLOPT_WRITEDATA");
-                if(curl_easy_setopt(curl_handle, CURLOPT_TIMEOUT, curlTimeoutInSeconds) != CURLE_OK)
-                    LOGWARN("Failed to set curl option: CURLOPT_TIMEOUT");
-
-                res = curl_easy_perform(curl_handle);
+                prepareConfigRequest(curl_handle, postData, parser);
+
+                res = lease.Perform();
                 curl_easy_getinfo(curl_handle, CURLINFO_RESPONSE_CODE, &http_code);
 
                 LOGWARN("Perfomed curl call : %d http response code: %ld", res, http_code);
-                curl_easy_cleanup(curl_handle);
             }
             else
             {
                 LOGWARN("Could not perform curl ");
+                res = CURLE_FAILED_INIT;
             }
 
             if (res == CURLE_OK && (http_code == 0 || http_code == 200))
             {
-                LOGWARN("curl Response: %s", response.c_str());
-
-                ParamList param;
-                std::string::size_type start = 0, end = 0;
-                while ((start = response.find("\"name\":", end)) != std::string::npos) 
+                // a partial list would be returned, and cached, as if complete;
+                // an empty body has no list at all and still succeeds
+                if (parser.HasError() || parser.IsTruncated())
                 {
-                    start = response.find("\"", start + 6) + 1;
-                    end = response.find("\"", start);
-                    param.name = response.substr(start, end - start);
-
-                    start = response.find("\"value\":", end) + 8;
-                    end = response.find("}", start);
-                    param.value = response.substr(start, end - start);
-
-                    paramListInfo.push_back(param);
+                    LOGERR("%s curl response after %u parameters", (parser.HasError() ? "Malformed" : "Truncated"), parser.Entries());
+                }
+                else
+                {
+                    LOGINFO("curl Response: %u parameters", parser.Entries());
+                    paramListInfo.splice(paramListInfo.end(), received);
+                    result = 0;
                 }
-                result = 0;
             }
             return result;
         }
     } // namespace Plugin
 } // namespace WPEFramework
-
-/***
- * @brief   : Used to read file contents into a list
- * @param1[in]      : Complete file name with path
- * @param2[in]      : Destination list buffer to be filled with file contents
- * @return  : <bool>; TRUE if operation success; else FALSE.
- */
-bool getFileContent(std::string fileName, std::list<std::string> & listOfStrs)
-{
-    bool retStatus = false;
-    std::ifstream inFile(fileName.c_str(), std::ios::in);
-
-    if (!inFile.is_open())
-        return retStatus;
-
-    std::string line;
-    retStatus = true;
-    while (std::getline(inFile, line)) {
-        if (line.size() > 0) {
-            listOfStrs.push_back(line);
-        }
-    }
-    inFile.close();
-    return retStatus;
-}
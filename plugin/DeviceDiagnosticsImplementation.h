@@ -19,13 +19,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <map>
 #include <thread>
+#include <vector>
 #include <mutex>
 #include <condition_variable>
-#ifdef ENABLE_ERM
-#include <essos-resmgr.h>
-#define AVDECODERSTATUS_RETRY_INTERVAL 30 // sec
-#endif
+#include <memory>
+#define AVDECODERSTATUS_MIN_POLL_INTERVAL 1000 // ms
+#define AVDECODERSTATUS_MAX_POLL_INTERVAL 5000 // ms
 #ifdef RDK_LOG_MILESTONE
 #include "rdk_logger_milestone.h"
 #endif
@@ -33,6 +35,26 @@
 #include "Module.h"
 #include <interfaces/Ids.h>
 #include <interfaces/IDeviceDiagnostics.h>
+#include <interfaces/IConfiguration.h>
+#include "interfaces/IDeviceDiagnosticsExt.h"
+#include "CallMetrics.h"
+#include "CurlHandlePool.h"
+#include "CurlMultiEngine.h"
+#include "DecoderEventDebouncer.h"
+#include "DecoderHistory.h"
+#include "DecoderPollScheduler.h"
+#include "DecoderStatusSource.h"
+#include "DeliveryQueue.h"
+#include "MilestoneLogger.h"
+#include "MilestoneReader.h"
+#include "MilestoneWatcher.h"
+#include "ParamListParser.h"
+#include "ParameterCache.h"
+#include "ReplayBuffer.h"
+#include "SeqLock.h"
+#include "SingleFlight.h"
+#include "SubscriberFilter.h"
+#include "SubscriberList.h"
 
 #include <com/com.h>
 #include <core/core.h>
@@ -41,7 +63,7 @@ namespace WPEFramework
 {
     namespace Plugin
     {
-        class DeviceDiagnosticsImplementation : public Exchange::IDeviceDiagnostics
+        class DeviceDiagnosticsImplementation : public Exchange::IDeviceDiagnostics, public Exchange::IDeviceDiagnosticsExt, public Exchange::IConfiguration
         {
             public:
                 // We do not allow this plugin to be copied !!
@@ -54,52 +76,160 @@ namespace WPEFramework
 
                 BEGIN_INTERFACE_MAP(DeviceDiagnosticsImplementation)
                 INTERFACE_ENTRY(Exchange::IDeviceDiagnostics)
+                INTERFACE_ENTRY(Exchange::IDeviceDiagnosticsExt)
+                INTERFACE_ENTRY(Exchange::IConfiguration)
                 END_INTERFACE_MAP
 
             public:
                 enum Event
                 {
-                    ON_AVDECODER_STATUSCHANGED
+                    ON_AVDECODER_STATUSCHANGED,
+                    ON_CONFIGURATION_RESULT,
+                    ON_MILESTONE_LOGGED,
+                    ON_DECODER_STATE_CHANGED
                 };
  
-            class EXTERNAL Job : public Core::IDispatch {
-            protected:
-                Job(DeviceDiagnosticsImplementation* deviceDiagnosticsImplementation, Event event, JsonValue &params)
-                    : _deviceDiagnosticsImplementation(deviceDiagnosticsImplementation)
-                    , _event(event)
-                    , _params(params) {
-                    if (_deviceDiagnosticsImplementation != nullptr) {
-                        _deviceDiagnosticsImplementation->AddRef();
-                    }
-                }
+                /* One event as every subscriber gets it, serialized once by the
+                 * producer and shared read-only by the Job delivering it */
+                struct EventData
+                {
+                    Event event;
+                    string text;            // AV status, milestone array or paramList, as sent
+                    string type;            // decoder type
+                    string status;          // decoder status
+                    uint32_t number;        // requestId or decoder id
+                    uint64_t timestamp;
+                    bool success;
+                };
+                typedef std::shared_ptr<const EventData> EventPayload;
+
+                /* One emission of an event: numbered, stamped, sharing the payload */
+                struct SequencedEvent
+                {
+                    uint64_t sequence;
+                    uint64_t timestamp;     // ms since the epoch
+                    EventPayload payload;
+                };
+                typedef DeliveryQueue<SequencedEvent> EventQueue;
+
+                /* One registered sink and the events waiting to be delivered to it */
+                class Subscriber
+                {
+                    public:
+                        Subscriber(const uint32_t id, const char* interface, const uint32_t capacity, const EventQueue::Overflow overflow, const EventFilter& wanted);
+                        virtual ~Subscriber() = default;
 
+                        Subscriber(const Subscriber&) = delete;
+                        Subscriber& operator=(const Subscriber&) = delete;
+
+                        virtual const void* Sink() const = 0;
+                        virtual void Deliver(const SequencedEvent& event) = 0;
+
+                    public:
+                        const uint32_t id;
+                        const char* const interface;
+                        SubscriberFilter<SequencedEvent> filter;
+                        EventQueue queue;
+                };
+
+                template <typename INTERFACE>
+                class SubscriberType : public Subscriber
+                {
+                    public:
+                        SubscriberType(INTERFACE* sink, const uint32_t id, const char* interface, const uint32_t capacity, const EventQueue::Overflow overflow, const EventFilter& wanted)
+                            : Subscriber(id, interface, capacity, overflow, wanted)
+                            , _sink(sink)
+                        {
+                            _sink->AddRef();
+                        }
+                        ~SubscriberType() override
+                        {
+                            _sink->Release();
+                        }
+
+                        const void* Sink() const override { return _sink; }
+                        void Deliver(const SequencedEvent& event) override { DeviceDiagnosticsImplementation::Deliver(_sink, event); }
+
+                    private:
+                        INTERFACE* _sink;
+                };
+
+            /* Drains the queue of one subscriber, or with flush first queues the
+             * events its filter held back, or emits an event off the calling
+             * thread. Jobs come from a pool and are reused once the worker pool
+             * is done with them; the pool calls Clear when a Job comes back,
+             * also one that was revoked or never ran, so an idle Job holds no
+             * reference */
+            class EXTERNAL Job : public Core::IDispatch {
             public:
-                Job() = delete;
+                Job()
+                    : _deviceDiagnosticsImplementation(nullptr)
+                    , _subscriber()
+                    , _flush(false)
+                    , _payload() {
+                }
                 Job(const Job&) = delete;
                 Job& operator=(const Job&) = delete;
                 ~Job() {
+                    Clear();
+                }
+
+            public:
+                static Core::ProxyType<Core::IDispatch> Create(DeviceDiagnosticsImplementation* deviceDiagnosticsImplementation, const std::shared_ptr<Subscriber>& subscriber, const bool flush = false) {
+                    return (Create(deviceDiagnosticsImplementation, subscriber, flush, EventPayload()));
+                }
+
+                static Core::ProxyType<Core::IDispatch> Create(DeviceDiagnosticsImplementation* deviceDiagnosticsImplementation, const EventPayload& payload) {
+                    return (Create(deviceDiagnosticsImplementation, std::shared_ptr<Subscriber>(), false, payload));
+                }
+
+                virtual void Dispatch() {
+                    if (_payload) {
+                        _deviceDiagnosticsImplementation->dispatchEvent(_payload);
+                    } else if (_flush) {
+                        _deviceDiagnosticsImplementation->Flush(_subscriber);
+                    } else {
+                        _deviceDiagnosticsImplementation->Dispatch(*_subscriber);
+                    }
+                }
+
+                void Clear() {
                     if (_deviceDiagnosticsImplementation != nullptr) {
                         _deviceDiagnosticsImplementation->Release();
+                        _deviceDiagnosticsImplementation = nullptr;
                     }
+                    _subscriber.reset();
+                    _flush = false;
+                    _payload.reset();
                 }
 
-            public:
-                static Core::ProxyType<Core::IDispatch> Create(DeviceDiagnosticsImplementation* deviceDiagnosticsImplementation, Event event, JsonValue  params ) {
+            private:
+                static Core::ProxyType<Core::IDispatch> Create(DeviceDiagnosticsImplementation* deviceDiagnosticsImplementation, const std::shared_ptr<Subscriber>& subscriber, const bool flush, const EventPayload& payload) {
+                    static Core::ProxyPoolType<Job> jobPool(4);
+
+                    Core::ProxyType<Job> job(jobPool.Element());
+                    job->Set(deviceDiagnosticsImplementation, subscriber, flush, payload);
 #ifndef USE_THUNDER_R4
-                    return (Core::proxy_cast<Core::IDispatch>(Core::ProxyType<Job>::Create(deviceDiagnosticsImplementation, event, params)));
+                    return (Core::proxy_cast<Core::IDispatch>(job));
 #else
-                    return (Core::ProxyType<Core::IDispatch>(Core::ProxyType<Job>::Create(deviceDiagnosticsImplementation, event, params)));
+                    return (Core::ProxyType<Core::IDispatch>(job));
 #endif
                 }
 
-                virtual void Dispatch() {
-                    _deviceDiagnosticsImplementation->Dispatch(_event, _params);
+                void Set(DeviceDiagnosticsImplementation* deviceDiagnosticsImplementation, const std::shared_ptr<Subscriber>& subscriber, const bool flush, const EventPayload& payload) {
+                    ASSERT(_deviceDiagnosticsImplementation == nullptr);
+                    _deviceDiagnosticsImplementation = deviceDiagnosticsImplementation;
+                    _deviceDiagnosticsImplementation->AddRef();
+                    _subscriber = subscriber;
+                    _flush = flush;
+                    _payload = payload;
                 }
 
             private:
                 DeviceDiagnosticsImplementation *_deviceDiagnosticsImplementation;
-                const Event _event;
-                JsonValue _params;
+                std::shared_ptr<Subscriber> _subscriber;
+                bool _flush;
+                EventPayload _payload;
         };
         public:
             virtual Core::hresult Register(Exchange::IDeviceDiagnostics::INotification *notification ) override ;
@@ -110,28 +240,122 @@ namespace WPEFramework
             Core::hresult LogMilestone(const string& marker, bool& success) override;
             Core::hresult GetAVDecoderStatus(AvDecoderStatusResult& AVDecoderStatus) override;
 
+            virtual Core::hresult Register(Exchange::IDeviceDiagnosticsExt::INotification *notification) override;
+            Core::hresult RegisterFiltered(Exchange::IDeviceDiagnosticsExt::INotification* notification, const EventFilter& filter) override;
+            Core::hresult RegisterSince(Exchange::IDeviceDiagnosticsExt::INotification* notification, const uint64_t since, bool& complete) override;
+            virtual Core::hresult Unregister(Exchange::IDeviceDiagnosticsExt::INotification *notification) override;
+
+            Core::hresult GetConfigurationStatistics(ConfigurationStatistics& statistics) override;
+            Core::hresult InvalidateConfigurationCache(const string& name, uint32_t& invalidated) override;
+            Core::hresult GetConfigurationAsync(RPC::IStringIterator* const& names, uint32_t& requestId) override;
+            Core::hresult QueryMilestones(const uint64_t since, const uint64_t until, const string& prefix, const string& contains,
+                const uint32_t offset, const uint32_t limit, RPC::IStringIterator*& milestones, uint32_t& total) override;
+            Core::hresult LogMilestones(RPC::IStringIterator* const& markers, bool& success) override;
+            Core::hresult GetDecoderPollStatistics(IDecoderPollModeIterator*& modes, uint32_t& interval) override;
+            Core::hresult GetAVDecoderStatusSnapshot(const bool fresh, AVDecoderStatusSnapshot& snapshot) override;
+            Core::hresult GetDecoderStates(IDecoderStateIterator*& decoders) override;
+            Core::hresult GetDecoderHistory(const uint32_t window, IDecoderStateHistoryIterator*& states, uint64_t& coveredMs, uint32_t& transitions) override;
+            Core::hresult GetDecoderEventStatistics(uint32_t& sent, uint32_t& suppressed) override;
+            Core::hresult GetSubscriberStatistics(ISubscriberStatisticsIterator*& subscribers, uint32_t& disconnected) override;
+            Core::hresult GetMetrics(const bool reset, IMethodMetricsIterator*& methods) override;
+            Core::hresult SetMethodTrace(const string& method, const bool enabled) override;
+            Core::hresult GetMethodTrace(RPC::IStringIterator*& methods) override;
+
+            // IConfiguration methods
+            uint32_t Configure(PluginHost::IShell* service) override;
+
         private:
-            mutable Core::CriticalSection _adminLock;
+            struct ConfigurationResult
+            {
+                int status;
+                std::list<ParamList> params;
+            };
+
+            struct DecoderStatus
+            {
+                int32_t status;
+                uint64_t timestamp; // ms since the epoch, 0 until the first read
+            };
+
+            /* IDeviceDiagnostics methods measured for getMetrics */
+            enum Api
+            {
+                API_REGISTER,
+                API_UNREGISTER,
+                API_GET_CONFIGURATION,
+                API_GET_MILESTONES,
+                API_LOG_MILESTONE,
+                API_GET_AV_DECODER_STATUS,
+                API_COUNT
+            };
+
             PluginHost::IShell* _service;
-            std::list<Exchange::IDeviceDiagnostics::INotification*> _deviceDiagnosticsNotification;
+            CallMetrics _apiMetrics[API_COUNT];
+            SubscriberList<Subscriber> _deviceDiagnosticsNotification;
+            SubscriberList<Subscriber> _deviceDiagnosticsExtNotification;
+            std::atomic<uint32_t> _nextSubscriberId;
+            std::atomic<uint32_t> _disconnectedSubscribers;
+            std::atomic<uint32_t> _notificationQueueSize;
+            std::atomic<int> _notificationOverflow;     // EventQueue::Overflow
+            std::mutex _sequenceLock;
+            uint64_t _sequence;                         // last one issued, guarded by _sequenceLock
+            ReplayBuffer<SequencedEvent> _replay;       // guarded by _sequenceLock
+            std::map<string, SequencedEvent> _stateEvents;  // latest event per decoder state, guarded by _sequenceLock
+            CurlHandlePool _curlHandlePool;
+            ParameterCache _parameterCache;
+            SingleFlight<ConfigurationResult> _configurationRequests;
+            CurlMultiEngine _asyncEngine;
+            std::atomic<uint32_t> _nextRequestId;
+            std::string _backendUrl;
+            std::string _backendSocket;
+            MilestoneReader _milestoneReader;
+            MilestoneWatcher _milestoneWatcher;
+            MilestoneLogger _milestoneLogger;
+            DecoderPollScheduler _decoderPollScheduler;
+            SeqLock<DecoderStatus> _decoderStatus;
+            std::atomic<uint32_t> _decoderReads;        // source reads started, under m_AVDecoderStatusLock
+            DecoderHistory _decoderHistory;
+            DecoderEventDebouncer _decoderEventDebouncer;
 
-#ifdef ENABLE_ERM
             std::thread m_AVPollThread;
             std::mutex m_AVDecoderStatusLock;
-            EssRMgr* m_EssRMgr;
+            std::unique_ptr<DecoderStatusSource> m_decoderStatusSource; // guarded by m_AVDecoderStatusLock
             int m_pollThreadRun;
             std::condition_variable m_avDecoderStatusCv;
-#endif
 
+            struct Decoder
+            {
+                DecoderStatusSource::Type type;
+                uint32_t id;
+                int status;
+                uint64_t lastTransition;    // ms since the epoch, 0 until the first change
+            };
+            std::vector<Decoder> m_decoders; // guarded by m_AVDecoderStatusLock
+
+            void openDecoderStatusSource(const string& source, const string& trace, const uint32_t speed, const uint32_t repeat);
             int getMostActiveDecoderStatus();
+            DecoderStatus queryDecoderStatus();
+            DecoderStatus publishDecoderStatus(const int status);
             void onDecoderStatusChange(int status);
             int getConfig(const std::string& postData, std::list<ParamList>& paramListInfo);
+            void prepareConfigRequest(CURL *curl_handle, const std::string& postData, ParamListParser& parser);
+            void lookupConfiguration(RPC::IStringIterator* names, std::list<string>& requested, std::map<string, string>& cached, std::list<string>& missing);
+            ConfigurationResult fetchConfiguration(const std::list<string>& names);
+            void mergeConfiguration(const std::list<string>& requested, const std::map<string, string>& cached, const std::list<ParamList>* fetched, std::list<ParamList>& paramListInfo);
+            void onConfigurationResult(const uint32_t requestId, const bool success, const std::list<ParamList>& paramListInfo);
+            void onMilestoneLogged(const std::list<string>& milestones);
 
-#ifdef ENABLE_ERM
             static void *AVPollThread(void *arg);
-#endif
-            void dispatchEvent(Event, const JsonValue &params);
-            void Dispatch(Event event, const JsonValue params);
+            void pollDecoderStates();
+            template <typename INTERFACE>
+            Core::hresult registerSubscriber(SubscriberList<Subscriber>& subscribers, INTERFACE* notification, const char* interface, const std::vector<SequencedEvent>& replay, const EventFilter& filter);
+            void queueEvent(SubscriberList<Subscriber>& subscribers, const SequencedEvent& event, std::vector<std::shared_ptr<Subscriber>>& disconnected);
+            void dispatchEvent(const EventPayload& payload);
+            void Dispatch(Subscriber& subscriber);
+            void Flush(const std::shared_ptr<Subscriber>& subscriber);
+            void scheduleFlush(const std::shared_ptr<Subscriber>& subscriber);
+            static void Deliver(Exchange::IDeviceDiagnostics::INotification* notification, const SequencedEvent& event);
+            static void Deliver(Exchange::IDeviceDiagnosticsExt::INotification* notification, const SequencedEvent& event);
         public:
             static DeviceDiagnosticsImplementation* _instance;
 
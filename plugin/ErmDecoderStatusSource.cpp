@@ -0,0 +1,86 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "ErmDecoderStatusSource.h"
+
+#ifdef ENABLE_ERM
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        static int resourceType(const DecoderStatusSource::Type type)
+        {
+            return (type == DecoderStatusSource::VIDEO ? EssRMgrResType_videoDecoder : EssRMgrResType_audioDecoder);
+        }
+
+        ErmDecoderStatusSource::ErmDecoderStatusSource()
+            : _essRMgr(nullptr)
+        {
+        }
+
+        ErmDecoderStatusSource::~ErmDecoderStatusSource()
+        {
+            if (_essRMgr != nullptr)
+            {
+                EssRMgrDestroy(_essRMgr);
+            }
+        }
+
+        bool ErmDecoderStatusSource::Open()
+        {
+            _essRMgr = EssRMgrCreate();
+            return (_essRMgr != nullptr);
+        }
+
+        void ErmDecoderStatusSource::Decoders(std::vector<Decoder>& decoders)
+        {
+            for (const Type type : { VIDEO, AUDIO })
+            {
+                const int count = EssRMgrResourceGetCount(_essRMgr, resourceType(type));
+                for (int id = 0; id < count; id++)
+                {
+                    decoders.push_back({ type, static_cast<uint32_t>(id) });
+                }
+            }
+        }
+
+        int ErmDecoderStatusSource::MostActive()
+        {
+            int status = EssRMgrRes_idle;
+            EssRMgrGetAVState(_essRMgr, &status);
+            return status;
+        }
+
+        bool ErmDecoderStatusSource::DecoderState(const Type type, const uint32_t id, int& state)
+        {
+            if (!EssRMgrResourceGetState(_essRMgr, resourceType(type), static_cast<int>(id), &state))
+            {
+                return false;
+            }
+            if ((state < EssRMgrRes_idle) || (state > EssRMgrRes_active))
+            {
+                state = EssRMgrRes_idle;
+            }
+            return true;
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
+#endif
@@ -0,0 +1,53 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#ifdef ENABLE_ERM
+#include <essos-resmgr.h>
+
+#include "DecoderStatusSource.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Decoder states as kept by the Essos resource manager (ERM). ERM
+         * has no change events, so it can only be polled. */
+        class ErmDecoderStatusSource : public DecoderStatusSource
+        {
+            public:
+                ErmDecoderStatusSource();
+                ~ErmDecoderStatusSource() override;
+
+                ErmDecoderStatusSource(const ErmDecoderStatusSource&) = delete;
+                ErmDecoderStatusSource& operator=(const ErmDecoderStatusSource&) = delete;
+
+                bool Open() override;
+                void Decoders(std::vector<Decoder>& decoders) override;
+                int MostActive() override;
+                bool DecoderState(const Type type, const uint32_t id, int& state) override;
+
+            private:
+                EssRMgr* _essRMgr;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
+#endif
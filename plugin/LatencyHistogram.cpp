@@ -0,0 +1,126 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "LatencyHistogram.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        constexpr uint32_t LatencyHistogram::SubBuckets;
+        constexpr uint32_t LatencyHistogram::Buckets;
+
+        LatencyHistogram::LatencyHistogram()
+            : _count(0)
+            , _sum(0)
+            , _max(0)
+        {
+            for (std::atomic<uint32_t>& bucket : _buckets)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        uint32_t LatencyHistogram::Index(const uint64_t value)
+        {
+            if (value >= (static_cast<uint64_t>(1) << 32))
+            {
+                return (Buckets - 1);
+            }
+            if (value < SubBuckets)
+            {
+                return static_cast<uint32_t>(value);
+            }
+            // the top 5 bits of the value: the power of two and 4 bits below it
+            const uint32_t exponent = 31 - static_cast<uint32_t>(__builtin_clz(static_cast<uint32_t>(value)));
+            const uint32_t sub = static_cast<uint32_t>(value >> (exponent - 4)) - SubBuckets;
+            return (SubBuckets + ((exponent - 4) * SubBuckets) + sub);
+        }
+
+        uint32_t LatencyHistogram::Upper(const uint32_t index)
+        {
+            if (index < SubBuckets)
+            {
+                return index;
+            }
+            const uint32_t exponent = ((index - SubBuckets) / SubBuckets) + 4;
+            const uint64_t sub = ((index - SubBuckets) % SubBuckets) + SubBuckets;
+            return static_cast<uint32_t>(((sub + 1) << (exponent - 4)) - 1);
+        }
+
+        void LatencyHistogram::Record(const uint64_t value)
+        {
+            _buckets[Index(value)].fetch_add(1, std::memory_order_relaxed);
+            _count.fetch_add(1, std::memory_order_relaxed);
+            _sum.fetch_add(value, std::memory_order_relaxed);
+
+            const uint32_t clamped = (value > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(value));
+            uint32_t max = _max.load(std::memory_order_relaxed);
+            while ((clamped > max) && (!_max.compare_exchange_weak(max, clamped, std::memory_order_relaxed)))
+            {
+            }
+        }
+
+        LatencyHistogram::Summary LatencyHistogram::Get() const
+        {
+            Summary summary;
+            uint32_t counts[Buckets];
+            uint64_t total = 0;
+
+            for (uint32_t index = 0; index < Buckets; index++)
+            {
+                counts[index] = _buckets[index].load(std::memory_order_relaxed);
+                total += counts[index];
+            }
+            summary.count = total;
+            summary.sum = _sum.load(std::memory_order_relaxed);
+            summary.max = _max.load(std::memory_order_relaxed);
+
+            const uint32_t percents[] = { 50, 90, 99 };
+            uint32_t* const results[] = { &summary.p50, &summary.p90, &summary.p99 };
+            uint64_t seen = 0;
+            uint32_t index = 0;
+            for (uint32_t percentile = 0; percentile < 3; percentile++)
+            {
+                // smallest bucket reaching the rank, rounded up
+                const uint64_t rank = ((total * percents[percentile]) + 99) / 100;
+                while ((index < Buckets) && ((seen + counts[index] < rank) || (counts[index] == 0)))
+                {
+                    seen += counts[index];
+                    index++;
+                }
+                const uint32_t upper = (index < Buckets ? Upper(index) : 0);
+                *results[percentile] = (upper < summary.max ? upper : summary.max);
+            }
+            return summary;
+        }
+
+        void LatencyHistogram::Reset()
+        {
+            for (std::atomic<uint32_t>& bucket : _buckets)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            _count.store(0, std::memory_order_relaxed);
+            _sum.store(0, std::memory_order_relaxed);
+            _max.store(0, std::memory_order_relaxed);
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,72 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Log-linear latency histogram in the style of HdrHistogram: values
+         * below 16 get a bucket each, every power of two above that is split
+         * into 16 buckets, so a bucket is at most 1/16th of its value wide.
+         * Recording is a few relaxed atomic adds, without a lock, so it can
+         * stay on in production. Values are microseconds, up to 2^32 - 1;
+         * larger ones land in the last bucket. A Get or Reset running during
+         * Record may see that one value partly counted. */
+        class LatencyHistogram
+        {
+            public:
+                static constexpr uint32_t SubBuckets = 16;
+                static constexpr uint32_t Buckets = SubBuckets + (32 - 4) * SubBuckets;
+
+                struct Summary
+                {
+                    uint64_t count;
+                    uint64_t sum;           // us
+                    uint32_t max;           // us
+                    uint32_t p50;           // percentiles, us, upper end of their bucket
+                    uint32_t p90;
+                    uint32_t p99;
+                };
+
+                LatencyHistogram();
+                ~LatencyHistogram() = default;
+
+                LatencyHistogram(const LatencyHistogram&) = delete;
+                LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+                void Record(const uint64_t value);
+                Summary Get() const;
+                void Reset();
+
+                static uint32_t Index(const uint64_t value);
+                static uint32_t Upper(const uint32_t index);
+
+            private:
+                std::atomic<uint32_t> _buckets[Buckets];
+                std::atomic<uint64_t> _count;
+                std::atomic<uint64_t> _sum;
+                std::atomic<uint32_t> _max;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
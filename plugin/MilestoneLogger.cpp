@@ -0,0 +1,132 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "MilestoneLogger.h"
+
+#include <chrono>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        MilestoneLogger::MilestoneLogger(const Writer& writer)
+            : _writer(writer)
+            , _lock()
+            , _signal()
+            , _queue()
+            , _queued(0)
+            , _capacity(0)
+            , _flushInterval(0)
+            , _running(false)
+            , _thread()
+        {
+        }
+
+        MilestoneLogger::~MilestoneLogger()
+        {
+            Stop();
+        }
+
+        void MilestoneLogger::Start(const uint32_t capacity, const uint32_t flushInterval)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            if (_running == false)
+            {
+                _capacity = ((capacity > 0) ? capacity : 1);
+                _flushInterval = flushInterval;
+                _running = true;
+                _thread = std::thread(&MilestoneLogger::Run, this);
+            }
+        }
+
+        void MilestoneLogger::Stop()
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+
+            if (_running == true)
+            {
+                _running = false;
+                lock.unlock();
+                _signal.notify_one();
+                _thread.join();
+            }
+        }
+
+        bool MilestoneLogger::Log(const std::string& marker)
+        {
+            std::list<std::string> markers;
+            markers.push_back(marker);
+            return Log(markers);
+        }
+
+        bool MilestoneLogger::Log(std::list<std::string>& markers)
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            const size_t count = markers.size();
+
+            if ((_running == false) || ((_queued + count) > _capacity))
+            {
+                return false;
+            }
+
+            // the writer only needs waking to start a batch or to cut it short
+            const bool wake = ((_queued == 0) || (((_queued + count) * 2) >= _capacity));
+            _queue.splice(_queue.end(), markers);
+            _queued += count;
+            lock.unlock();
+
+            if (wake == true)
+            {
+                _signal.notify_one();
+            }
+            return true;
+        }
+
+        void MilestoneLogger::Run()
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+
+            while ((_running == true) || (_queued > 0))
+            {
+                if (_queued == 0)
+                {
+                    _signal.wait(lock, [this]() { return ((_running == false) || (_queued > 0)); });
+                    continue;
+                }
+
+                if (_flushInterval > 0)
+                {
+                    _signal.wait_for(lock, std::chrono::milliseconds(_flushInterval),
+                        [this]() { return ((_running == false) || ((_queued * 2) >= _capacity)); });
+                }
+
+                std::list<std::string> batch;
+                batch.swap(_queue);
+                _queued = 0;
+                lock.unlock();
+
+                _writer(batch);
+
+                lock.lock();
+            }
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
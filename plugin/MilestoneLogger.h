@@ -0,0 +1,75 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Takes milestone logging off the caller's thread: markers go into a
+         * bounded queue, a writer thread hands them to the writer in batches.
+         * A batch is written once the flush interval has passed since its
+         * first marker or once half the queue is filled. Markers that do not
+         * fit are refused; a list of markers is queued as a whole or not at
+         * all. Stop writes everything still queued before it returns. */
+        class MilestoneLogger
+        {
+            public:
+                typedef std::function<void(const std::list<std::string>& markers)> Writer;
+
+                explicit MilestoneLogger(const Writer& writer);
+                ~MilestoneLogger();
+
+                MilestoneLogger(const MilestoneLogger&) = delete;
+                MilestoneLogger& operator=(const MilestoneLogger&) = delete;
+
+                /* capacity in markers, flushInterval in milliseconds */
+                void Start(const uint32_t capacity, const uint32_t flushInterval);
+                void Stop();
+
+                /* false when the queue is full or the logger is stopped */
+                bool Log(const std::string& marker);
+                bool Log(std::list<std::string>& markers);
+
+            private:
+                void Run();
+
+            private:
+                Writer _writer;
+                std::mutex _lock;
+                std::condition_variable _signal;
+                std::list<std::string> _queue;
+                size_t _queued;
+                uint32_t _capacity;
+                uint32_t _flushInterval;
+                bool _running;
+                std::thread _thread;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,430 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "MilestoneReader.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        constexpr uint64_t MilestoneReader::NoTime;
+
+        static inline bool isDigit(const char c)
+        {
+            return ((c >= '0') && (c <= '9'));
+        }
+
+        static uint32_t digits(const char* text, const size_t count)
+        {
+            uint32_t value = 0;
+            for (size_t index = 0; index < count; index++)
+            {
+                value = (value * 10) + static_cast<uint32_t>(text[index] - '0');
+            }
+            return value;
+        }
+
+        /* "YYYY-MM-DD HH:MM:SS" in UTC to milliseconds since the epoch */
+        static bool dateTime(const char* text, const size_t length, uint64_t& time)
+        {
+            static const char pattern[] = "dddd-dd-dd dd:dd:dd";
+
+            if (length < (sizeof(pattern) - 1))
+            {
+                return false;
+            }
+            for (size_t index = 0; index < (sizeof(pattern) - 1); index++)
+            {
+                if ((pattern[index] == 'd') ? !isDigit(text[index]) : (text[index] != pattern[index]))
+                {
+                    return false;
+                }
+            }
+
+            // days from civil, proleptic Gregorian calendar
+            int64_t year = digits(text, 4);
+            const uint32_t month = digits(text + 5, 2);
+            const uint32_t day = digits(text + 8, 2);
+            year -= (month <= 2) ? 1 : 0;
+            const int64_t era = (year >= 0 ? year : year - 399) / 400;
+            const int64_t yoe = year - era * 400;
+            const int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+            const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+            const int64_t days = era * 146097 + doe - 719468;
+
+            const int64_t seconds = days * 86400 + digits(text + 11, 2) * 3600 + digits(text + 14, 2) * 60 + digits(text + 17, 2);
+            if (seconds < 0)
+            {
+                return false;
+            }
+            time = static_cast<uint64_t>(seconds) * 1000;
+            return true;
+        }
+
+        MilestoneReader::MilestoneReader(const std::string& path)
+            : _lock()
+            , _path(path)
+            , _device(0)
+            , _inode(0)
+            , _modified()
+            , _data()
+            , _indexed(0)
+            , _lines()
+            , _timed()
+            , _ordered(true)
+            , _generation(0)
+        {
+        }
+
+        MilestoneReader::~MilestoneReader()
+        {
+            Reset();
+        }
+
+        bool MilestoneReader::Read(std::list<std::string>& lines)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            if (Refresh() == false)
+            {
+                return false;
+            }
+
+            for (const Entry& entry : _lines)
+            {
+                lines.emplace_back(_data, entry.offset, entry.length);
+            }
+            if (_indexed < _data.size())
+            {
+                lines.emplace_back(_data, _indexed, std::string::npos);
+            }
+            return true;
+        }
+
+        bool MilestoneReader::Refresh()
+        {
+            struct stat status;
+
+            if (stat(_path.c_str(), &status) != 0)
+            {
+                Reset();
+                return false;
+            }
+
+            // an unchanged file costs this one stat
+            if ((status.st_dev == _device) && (status.st_ino == _inode) && (static_cast<size_t>(status.st_size) == _data.size()) &&
+                (status.st_mtim.tv_sec == _modified.tv_sec) && (status.st_mtim.tv_nsec == _modified.tv_nsec))
+            {
+                return true;
+            }
+
+            int fd = open(_path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+            {
+                return false;
+            }
+
+            // decide on the opened file, it may have moved on since the stat
+            if (fstat(fd, &status) != 0)
+            {
+                close(fd);
+                return false;
+            }
+
+            // anything but whole lines appended to the same file is a rewrite:
+            // a write at the same size, or indexed bytes no longer ending a line
+            const size_t size = static_cast<size_t>(status.st_size);
+            const bool modified = ((status.st_mtim.tv_sec != _modified.tv_sec) || (status.st_mtim.tv_nsec != _modified.tv_nsec));
+            char last = '\n';
+            if ((status.st_dev != _device) || (status.st_ino != _inode) || (size < _data.size()) || ((size == _data.size()) && modified) ||
+                ((_indexed > 0) && ((pread(fd, &last, 1, static_cast<off_t>(_indexed - 1)) != 1) || (last != '\n'))))
+            {
+                Reset();
+            }
+
+            // a truncation racing the read only makes it come up short
+            size_t filled = _data.size();
+            _data.resize(size);
+            while (filled < _data.size())
+            {
+                const ssize_t count = pread(fd, &_data[filled], _data.size() - filled, static_cast<off_t>(filled));
+                if (count > 0)
+                {
+                    filled += static_cast<size_t>(count);
+                }
+                else if ((count == 0) || (errno != EINTR))
+                {
+                    break;
+                }
+            }
+            _data.resize(filled);
+            close(fd);
+
+            _device = status.st_dev;
+            _inode = status.st_ino;
+            _modified = status.st_mtim;
+
+            Index(_indexed);
+            return true;
+        }
+
+        void MilestoneReader::Index(const size_t from)
+        {
+            size_t start = from;
+
+            const char* data = _data.data();
+            const size_t size = _data.size();
+
+            while (start < size)
+            {
+                const char* end = static_cast<const char*>(memchr(data + start, '\n', size - start));
+                if (end == nullptr)
+                {
+                    break;
+                }
+
+                const size_t length = static_cast<size_t>(end - (data + start));
+                if (length > 0)
+                {
+                    const Entry entry = Parse(start, length);
+                    if (entry.time != NoTime)
+                    {
+                        if ((_timed.empty() == false) && (entry.time < _lines[_timed.back()].time))
+                        {
+                            _ordered = false;
+                        }
+                        _timed.push_back(static_cast<uint32_t>(_lines.size()));
+                    }
+                    _lines.push_back(entry);
+                }
+                start += length + 1;
+            }
+            _indexed = start;
+        }
+
+        /* Forgets the file; a new generation only when something was held, so
+         * a missing file polled again and again does not move cursors on */
+        void MilestoneReader::Reset()
+        {
+            if ((_inode == 0) && (_data.empty() == true))
+            {
+                return;
+            }
+            _device = 0;
+            _inode = 0;
+            _modified = {};
+            std::string().swap(_data);
+            _indexed = 0;
+            std::vector<Entry>().swap(_lines);
+            std::vector<uint32_t>().swap(_timed);
+            _ordered = true;
+            _generation++;
+        }
+
+        bool MilestoneReader::Appended(Cursor& cursor, std::list<std::string>& lines)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            if (Refresh() == false)
+            {
+                return false;
+            }
+
+            uint32_t line = ((cursor.generation == _generation) ? cursor.line : 0);
+            for (; line < _lines.size(); line++)
+            {
+                lines.emplace_back(_data, _lines[line].offset, _lines[line].length);
+            }
+            cursor.generation = _generation;
+            cursor.line = line;
+            return true;
+        }
+
+        void MilestoneReader::End(Cursor& cursor)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            Refresh();
+            cursor.generation = _generation;
+            cursor.line = static_cast<uint32_t>(_lines.size());
+        }
+
+        bool MilestoneReader::Query(const Filter& filter, const uint32_t offset, const uint32_t limit, std::list<std::string>& lines, uint32_t& total)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            uint32_t returned = 0;
+
+            if (Refresh() == false)
+            {
+                return false;
+            }
+
+            total = 0;
+            auto visit = [&](const Entry& entry) {
+                if (Matches(entry, filter) == true)
+                {
+                    if ((total >= offset) && ((limit == 0) || (returned < limit)))
+                    {
+                        lines.emplace_back(_data, entry.offset, entry.length);
+                        returned++;
+                    }
+                    total++;
+                }
+            };
+
+            if (((filter.since != 0) || (filter.until != 0)) && (_ordered == true))
+            {
+                // times only grow, so the bounds are two binary searches over the timed lines
+                auto first = _timed.cbegin();
+                auto last = _timed.cend();
+                if (filter.since != 0)
+                {
+                    first = std::lower_bound(first, last, filter.since,
+                        [this](const uint32_t index, const uint64_t time) { return (_lines[index].time < time); });
+                }
+                if (filter.until != 0)
+                {
+                    last = std::upper_bound(first, last, filter.until,
+                        [this](const uint64_t time, const uint32_t index) { return (time < _lines[index].time); });
+                }
+                for (; first != last; ++first)
+                {
+                    visit(_lines[*first]);
+                }
+            }
+            else
+            {
+                for (const Entry& entry : _lines)
+                {
+                    visit(entry);
+                }
+            }
+
+            if (_indexed < _data.size())
+            {
+                visit(Parse(_indexed, _data.size() - _indexed));
+            }
+            return true;
+        }
+
+        MilestoneReader::Entry MilestoneReader::Parse(const size_t offset, const size_t length) const
+        {
+            const char* line = _data.data() + offset;
+            Entry entry;
+
+            entry.offset = offset;
+            entry.length = static_cast<uint32_t>(length);
+            entry.markerOffset = 0;
+            entry.markerLength = static_cast<uint32_t>(length);
+            entry.time = NoTime;
+
+            if (dateTime(line, length, entry.time) == true)
+            {
+                size_t marker = 19;
+                while ((marker < length) && ((line[marker] == '.') || isDigit(line[marker])))
+                    marker++;
+                while ((marker < length) && (line[marker] == ' '))
+                    marker++;
+                if ((marker < length) && (line[marker] == '['))
+                {
+                    const char* close = static_cast<const char*>(memchr(line + marker, ']', length - marker));
+                    if (close != nullptr)
+                    {
+                        marker = static_cast<size_t>(close - line) + 1;
+                        while ((marker < length) && (line[marker] == ' '))
+                            marker++;
+                    }
+                }
+                entry.markerOffset = static_cast<uint32_t>(marker);
+                entry.markerLength = static_cast<uint32_t>(length - marker);
+            }
+            else
+            {
+                size_t colon = length;
+                while ((colon > 0) && (line[colon - 1] != ':'))
+                    colon--;
+
+                if (colon > 1)
+                {
+                    // "MARKER:uptime", the uptime may carry a fraction
+                    size_t end = colon;
+                    uint64_t time = 0;
+                    while ((end < length) && isDigit(line[end]))
+                    {
+                        time = (time * 10) + static_cast<uint64_t>(line[end] - '0');
+                        end++;
+                    }
+                    const bool number = (end > colon);
+                    if ((end < length) && (line[end] == '.'))
+                    {
+                        end++;
+                        while ((end < length) && isDigit(line[end]))
+                            end++;
+                    }
+                    while ((end < length) && ((line[end] == ' ') || (line[end] == '\r')))
+                        end++;
+
+                    if (number && (end == length))
+                    {
+                        entry.time = time;
+                        entry.markerLength = static_cast<uint32_t>(colon - 1);
+                    }
+                }
+            }
+            return entry;
+        }
+
+        bool MilestoneReader::Matches(const Entry& entry, const Filter& filter) const
+        {
+            if ((filter.since != 0) || (filter.until != 0))
+            {
+                if ((entry.time == NoTime) || ((filter.since != 0) && (entry.time < filter.since)) || ((filter.until != 0) && (entry.time > filter.until)))
+                {
+                    return false;
+                }
+            }
+
+            if (filter.prefix.empty() == false)
+            {
+                if ((entry.markerLength < filter.prefix.size()) ||
+                    (memcmp(_data.data() + entry.offset + entry.markerOffset, filter.prefix.data(), filter.prefix.size()) != 0))
+                {
+                    return false;
+                }
+            }
+
+            if (filter.contains.empty() == false)
+            {
+                if (memmem(_data.data() + entry.offset, entry.length, filter.contains.data(), filter.contains.size()) == nullptr)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
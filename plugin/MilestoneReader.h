@@ -0,0 +1,124 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <sys/types.h>
+#include <time.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Change aware reader for an append-only log file. The file is read
+         * into a buffer the reader owns, appended bytes with one pread, and an
+         * index of line offsets is kept, so a call after an append only reads
+         * and scans the new bytes and a call on an unchanged file costs one
+         * stat. The file is never mapped: logrotate truncates it in place, and
+         * a truncation only ever shortens a read where a mapping would fault.
+         * A new inode, a smaller size, a rewrite at the same size or a missing
+         * file drops the index, once per change, and the next read starts from
+         * scratch. Empty lines are skipped, an unterminated last line is
+         * reported as is. The whole file stays resident, the file size plus up
+         * to 36 bytes per line, until it is rotated or the reader destroyed.
+         *
+         * Every indexed line also records its time and marker, so queries only
+         * compare index entries and copy out the lines they return. A line
+         * starting with "YYYY-MM-DD HH:MM:SS" has that time in milliseconds
+         * since the epoch (UTC) and the text after it, minus a "[LEVEL]" tag,
+         * as marker. A "MARKER:<uptime ms>" line, as written by the RDK
+         * logger, has the uptime as time and the text before the colon as
+         * marker. Any other line has no time and is its own marker. */
+        class MilestoneReader
+        {
+            public:
+                static constexpr uint64_t NoTime = ~0ull;
+
+                struct Filter
+                {
+                    uint64_t since;          // 0 for no lower bound, inclusive
+                    uint64_t until;          // 0 for no upper bound, inclusive
+                    std::string prefix;      // marker prefix, empty matches all
+                    std::string contains;    // substring of the whole line, empty matches all
+                };
+
+                /* Position in the line index; the generation changes whenever the index is dropped */
+                struct Cursor
+                {
+                    uint32_t generation;
+                    uint32_t line;
+                };
+
+                explicit MilestoneReader(const std::string& path);
+                ~MilestoneReader();
+
+                MilestoneReader(const MilestoneReader&) = delete;
+                MilestoneReader& operator=(const MilestoneReader&) = delete;
+
+                /* false when the file does not exist or cannot be read */
+                bool Read(std::list<std::string>& lines);
+
+                /* Lines matching filter, skipping offset matches and returning at
+                 * most limit (0 for all); total is the number of matches. */
+                bool Query(const Filter& filter, const uint32_t offset, const uint32_t limit, std::list<std::string>& lines, uint32_t& total);
+
+                /* Complete lines indexed since cursor, which is moved past them.
+                 * After a rewrite or rotation the new file is read from its first
+                 * line. End places cursor after the last complete line. */
+                bool Appended(Cursor& cursor, std::list<std::string>& lines);
+                void End(Cursor& cursor);
+
+            private:
+                struct Entry
+                {
+                    size_t offset;
+                    uint32_t length;
+                    uint32_t markerOffset;
+                    uint32_t markerLength;
+                    uint64_t time;
+                };
+
+                bool Refresh();
+                void Index(const size_t from);
+                void Reset();
+                Entry Parse(const size_t offset, const size_t length) const;
+                bool Matches(const Entry& entry, const Filter& filter) const;
+
+            private:
+                std::mutex _lock;
+                const std::string _path;
+                dev_t _device;
+                ino_t _inode;
+                struct timespec _modified;
+                std::string _data;
+                size_t _indexed;
+                std::vector<Entry> _lines;
+                std::vector<uint32_t> _timed;
+                bool _ordered;
+                uint32_t _generation;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
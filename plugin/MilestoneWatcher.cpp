@@ -0,0 +1,244 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "Module.h"
+#include "MilestoneWatcher.h"
+
+#include "UtilsLogging.h"
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        constexpr uint32_t MilestoneWatcher::MaxBatch;
+
+        MilestoneWatcher::MilestoneWatcher(MilestoneReader& reader, const std::string& path, const Handler& handler)
+            : _reader(reader)
+            , _path(path)
+            , _directory(path.find('/') == std::string::npos ? std::string(".") : path.substr(0, path.rfind('/') + 1))
+            , _name(path.substr(path.rfind('/') + 1))
+            , _handler(handler)
+            , _batchInterval(0)
+            , _inotify(-1)
+            , _fileWatch(-1)
+            , _wakeup(-1)
+            , _thread()
+        {
+        }
+
+        MilestoneWatcher::~MilestoneWatcher()
+        {
+            Stop();
+        }
+
+        bool MilestoneWatcher::Start(const uint32_t batchInterval)
+        {
+            if (_thread.joinable())
+            {
+                return true;
+            }
+
+            _inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            _wakeup = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if ((_inotify < 0) || (_wakeup < 0))
+            {
+                LOGERR("Cannot create the milestone watch: %s", strerror(errno));
+                Stop();
+                return false;
+            }
+
+            if (inotify_add_watch(_inotify, _directory.c_str(), IN_CREATE | IN_MOVED_TO | IN_ONLYDIR) < 0)
+            {
+                LOGERR("Cannot watch %s: %s", _directory.c_str(), strerror(errno));
+                Stop();
+                return false;
+            }
+            // the log may not exist yet, it is watched once it is created
+            WatchFile();
+
+            _batchInterval = batchInterval;
+            _thread = std::thread(&MilestoneWatcher::Run, this);
+            return true;
+        }
+
+        void MilestoneWatcher::Stop()
+        {
+            if (_thread.joinable())
+            {
+                const uint64_t wake = 1;
+                if (write(_wakeup, &wake, sizeof(wake)) != sizeof(wake))
+                {
+                    LOGWARN("Cannot wake the milestone watcher: %s", strerror(errno));
+                }
+                _thread.join();
+            }
+            if (_inotify >= 0)
+            {
+                close(_inotify);
+                _inotify = -1;
+                _fileWatch = -1;
+            }
+            if (_wakeup >= 0)
+            {
+                close(_wakeup);
+                _wakeup = -1;
+            }
+        }
+
+        /* Moves the file watch to whatever file the log path names now */
+        void MilestoneWatcher::WatchFile()
+        {
+            const int watch = inotify_add_watch(_inotify, _path.c_str(), IN_MODIFY);
+
+            if ((_fileWatch >= 0) && (_fileWatch != watch))
+            {
+                // the rotated log is no longer written
+                inotify_rm_watch(_inotify, _fileWatch);
+            }
+            _fileWatch = watch;
+        }
+
+        /* Drains the inotify queue, true when one of the events was about the log */
+        bool MilestoneWatcher::Changed()
+        {
+            alignas(struct inotify_event) char buffer[4096];
+            bool changed = false;
+            bool replaced = false;
+            ssize_t length;
+
+            while ((length = read(_inotify, buffer, sizeof(buffer))) > 0)
+            {
+                for (ssize_t offset = 0; offset < length;)
+                {
+                    const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(buffer + offset);
+                    if ((event->mask & IN_Q_OVERFLOW) != 0)
+                    {
+                        changed = true;
+                        replaced = true;
+                    }
+                    else if (event->wd == _fileWatch)
+                    {
+                        if ((event->mask & IN_IGNORED) != 0)
+                        {
+                            _fileWatch = -1;
+                        }
+                        changed = true;
+                    }
+                    else if ((event->len > 0) && (_name == event->name))
+                    {
+                        changed = true;
+                        replaced = true;
+                    }
+                    offset += sizeof(struct inotify_event) + event->len;
+                }
+            }
+
+            if (replaced)
+            {
+                WatchFile();
+            }
+            return changed;
+        }
+
+        void MilestoneWatcher::Deliver(std::list<std::string>& pending)
+        {
+            const uint32_t batch = ((_batchInterval == 0) ? 1 : MaxBatch);
+
+            while (pending.empty() == false)
+            {
+                std::list<std::string> lines;
+                auto end = pending.begin();
+                for (uint32_t count = 0; (count < batch) && (end != pending.end()); count++)
+                {
+                    ++end;
+                }
+                lines.splice(lines.end(), pending, pending.begin(), end);
+                _handler(lines);
+            }
+        }
+
+        void MilestoneWatcher::Run()
+        {
+            std::list<std::string> pending;
+            std::chrono::steady_clock::time_point deadline;
+            MilestoneReader::Cursor cursor;
+            struct pollfd fds[2];
+
+            // only what is logged from now on is new
+            _reader.End(cursor);
+
+            fds[0].fd = _inotify;
+            fds[0].events = POLLIN;
+            fds[1].fd = _wakeup;
+            fds[1].events = POLLIN;
+
+            while (true)
+            {
+                int timeout = -1;
+                if (pending.empty() == false)
+                {
+                    const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+                    timeout = ((remaining > 0) ? static_cast<int>(remaining) : 0);
+                }
+
+                if ((poll(fds, 2, timeout) < 0) && (errno != EINTR))
+                {
+                    LOGERR("Milestone watch failed: %s", strerror(errno));
+                    break;
+                }
+                if ((fds[1].revents & POLLIN) != 0)
+                {
+                    break;
+                }
+
+                if (((fds[0].revents & POLLIN) != 0) && (Changed() == true))
+                {
+                    std::list<std::string> lines;
+                    if ((_reader.Appended(cursor, lines) == true) && (lines.empty() == false))
+                    {
+                        if (pending.empty() == true)
+                        {
+                            deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(_batchInterval);
+                        }
+                        pending.splice(pending.end(), lines);
+                    }
+                }
+
+                if ((pending.empty() == false) && ((pending.size() >= MaxBatch) || (std::chrono::steady_clock::now() >= deadline)))
+                {
+                    Deliver(pending);
+                }
+            }
+
+            if (pending.empty() == false)
+            {
+                LOGWARN("Dropping %zu milestones not notified yet", pending.size());
+            }
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
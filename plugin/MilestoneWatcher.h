@@ -0,0 +1,81 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <thread>
+
+#include "MilestoneReader.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Follows the milestone log with inotify and hands the lines appended
+         * to it to a handler, on the watcher thread. Writes are watched on the
+         * file itself, so the other logs in the directory never wake the
+         * thread. The directory is only watched for a file of that name being
+         * created or moved in, which moves the file watch to the new log after
+         * a rotation. With a batch interval the lines of a burst are collected
+         * for that long after the first one and handed over together, without
+         * one every line is handed over on its own. */
+        class MilestoneWatcher
+        {
+            public:
+                typedef std::function<void(std::list<std::string>& lines)> Handler;
+
+                /* Lines handed over at most per call, also within a batch interval */
+                static constexpr uint32_t MaxBatch = 64;
+
+                MilestoneWatcher(MilestoneReader& reader, const std::string& path, const Handler& handler);
+                ~MilestoneWatcher();
+
+                MilestoneWatcher(const MilestoneWatcher&) = delete;
+                MilestoneWatcher& operator=(const MilestoneWatcher&) = delete;
+
+                /* batchInterval in milliseconds, 0 hands every line over on its own */
+                bool Start(const uint32_t batchInterval);
+                /* Lines not handed over yet are dropped */
+                void Stop();
+
+            private:
+                bool Changed();
+                void WatchFile();
+                void Deliver(std::list<std::string>& pending);
+                void Run();
+
+            private:
+                MilestoneReader& _reader;
+                const std::string _path;
+                const std::string _directory;
+                const std::string _name;
+                Handler _handler;
+                uint32_t _batchInterval;
+                int _inotify;
+                int _fileWatch;
+                int _wakeup;
+                std::thread _thread;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
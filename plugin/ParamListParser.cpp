@@ -0,0 +1,435 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "ParamListParser.h"
+
+#include <cstring>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        static inline bool isLiteral(const char c)
+        {
+            return (((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
+                    (c == '-') || (c == '+') || (c == '.'));
+        }
+
+        static inline int hexValue(const char c)
+        {
+            if ((c >= '0') && (c <= '9'))
+                return (c - '0');
+            if ((c >= 'a') && (c <= 'f'))
+                return (c - 'a' + 10);
+            if ((c >= 'A') && (c <= 'F'))
+                return (c - 'A' + 10);
+            return -1;
+        }
+
+        ParamListParser::ParamListParser(const Handler& handler)
+            : _handler(handler)
+        {
+            _scopes.reserve(8);
+            Reset();
+        }
+
+        void ParamListParser::Reset()
+        {
+            _scopes.clear();
+            _expect = Expect::VALUE;
+            _field = Field::NONE;
+            _target = Target::DISCARD;
+            _started = false;
+            _done = false;
+            _error = false;
+            _inString = false;
+            _inLiteral = false;
+            _escape = false;
+            _unicode = 0;
+            _codePoint = 0;
+            _highSurrogate = 0;
+            _capture = false;
+            _captureDepth = 0;
+            _entryDepth = 0;
+            _hasName = false;
+            _key.clear();
+            _name.clear();
+            _value.clear();
+            _entries = 0;
+        }
+
+        void ParamListParser::Feed(const char* data, const size_t length)
+        {
+            const char* current = data;
+            const char* const end = data + length;
+
+            while ((current < end) && (_done == false) && (_error == false))
+            {
+                if (_inString == true)
+                {
+                    current = String(current, end);
+                    continue;
+                }
+
+                const char c = *current;
+
+                if (_inLiteral == true)
+                {
+                    if (isLiteral(c) == true)
+                    {
+                        if (_capture == true)
+                            _value.push_back(c);
+                        ++current;
+                        continue;
+                    }
+                    _inLiteral = false;
+                    ValueEnd();
+                }
+                ++current;
+
+                // Anything in front of the top level value is not ours
+                if (_started == false)
+                {
+                    if ((c != '{') && (c != '['))
+                        continue;
+                    _started = true;
+                }
+
+                switch (c)
+                {
+                    case ' ':
+                    case '\t':
+                    case '\r':
+                    case '\n':
+                        if (_capture == true)
+                            _value.push_back(c);
+                        break;
+
+                    case '"':
+                        if ((_expect == Expect::KEY) || (_expect == Expect::KEY_OR_END))
+                        {
+                            _target = Target::KEY;
+                            _key.clear();
+                            _expect = Expect::COLON;
+                        }
+                        else if ((_expect == Expect::VALUE) || (_expect == Expect::VALUE_OR_END))
+                        {
+                            ValueStart(true);
+                        }
+                        else
+                        {
+                            _error = true;
+                            break;
+                        }
+                        if (_capture == true)
+                            _value.push_back(c);
+                        _inString = true;
+                        break;
+
+                    case '{':
+                    case '[':
+                        if ((_expect != Expect::VALUE) && (_expect != Expect::VALUE_OR_END))
+                        {
+                            _error = true;
+                            break;
+                        }
+                        ValueStart(false);
+                        if (_capture == true)
+                            _value.push_back(c);
+                        _scopes.push_back(c == '{' ? Scope::OBJECT : Scope::ARRAY);
+                        _expect = (c == '{' ? Expect::KEY_OR_END : Expect::VALUE_OR_END);
+                        break;
+
+                    case '}':
+                    case ']':
+                    {
+                        const Scope scope = (c == '}' ? Scope::OBJECT : Scope::ARRAY);
+                        const Expect empty = (c == '}' ? Expect::KEY_OR_END : Expect::VALUE_OR_END);
+
+                        if ((_scopes.empty() == true) || (_scopes.back() != scope) ||
+                            ((_expect != Expect::COMMA_OR_END) && (_expect != empty)))
+                        {
+                            _error = true;
+                            break;
+                        }
+                        if (_capture == true)
+                            _value.push_back(c);
+                        if (scope == Scope::OBJECT)
+                            ObjectEnd();
+                        _scopes.pop_back();
+                        if (_scopes.empty() == true)
+                            _done = true;
+                        else
+                            ValueEnd();
+                        break;
+                    }
+
+                    case ':':
+                        if (_expect != Expect::COLON)
+                        {
+                            _error = true;
+                            break;
+                        }
+                        if (_capture == true)
+                            _value.push_back(c);
+                        _expect = Expect::VALUE;
+                        break;
+
+                    case ',':
+                        if (_expect != Expect::COMMA_OR_END)
+                        {
+                            _error = true;
+                            break;
+                        }
+                        if (_capture == true)
+                            _value.push_back(c);
+                        _expect = (_scopes.back() == Scope::OBJECT ? Expect::KEY : Expect::VALUE);
+                        break;
+
+                    default:
+                        if (((_expect != Expect::VALUE) && (_expect != Expect::VALUE_OR_END)) || (isLiteral(c) == false))
+                        {
+                            _error = true;
+                            break;
+                        }
+                        ValueStart(false);
+                        if (_capture == true)
+                            _value.push_back(c);
+                        _inLiteral = true;
+                        break;
+                }
+            }
+        }
+
+        const char* ParamListParser::String(const char* current, const char* end)
+        {
+            while (current < end)
+            {
+                if (_unicode > 0)
+                {
+                    const char c = *current++;
+                    const int digit = hexValue(c);
+
+                    if (digit < 0)
+                    {
+                        _error = true;
+                        break;
+                    }
+                    if (_capture == true)
+                        _value.push_back(c);
+                    _codePoint = (_codePoint << 4) | static_cast<uint32_t>(digit);
+                    if (--_unicode == 0)
+                        AppendCodePoint(_codePoint);
+                    continue;
+                }
+
+                if (_escape == true)
+                {
+                    const char c = *current++;
+
+                    _escape = false;
+                    if (_capture == true)
+                        _value.push_back(c);
+
+                    switch (c)
+                    {
+                        case 'u': _unicode = 4; _codePoint = 0; break;
+                        case 'b': Append('\b'); break;
+                        case 'f': Append('\f'); break;
+                        case 'n': Append('\n'); break;
+                        case 'r': Append('\r'); break;
+                        case 't': Append('\t'); break;
+                        case '"':
+                        case '\\':
+                        case '/': Append(c); break;
+                        default: _error = true; break;
+                    }
+                    continue;
+                }
+
+                // Plain characters are appended as one run, up to the next quote or escape
+                const char* run = current;
+                const char* quote = static_cast<const char*>(memchr(current, '"', static_cast<size_t>(end - current)));
+                const char* limit = (quote != nullptr ? quote : end);
+                const char* escape = static_cast<const char*>(memchr(current, '\\', static_cast<size_t>(limit - current)));
+                current = (escape != nullptr ? escape : limit);
+
+                if (current != run)
+                {
+                    Append(run, static_cast<size_t>(current - run));
+                    if (_capture == true)
+                        _value.append(run, static_cast<size_t>(current - run));
+                }
+
+                if (current == end)
+                    break;
+
+                if (*current == '\\')
+                {
+                    _escape = true;
+                    if (_capture == true)
+                        _value.push_back('\\');
+                    ++current;
+                    continue;
+                }
+
+                // closing quote
+                if (_capture == true)
+                    _value.push_back('"');
+                ++current;
+                _inString = false;
+                StringEnd();
+                break;
+            }
+            return current;
+        }
+
+        void ParamListParser::StringEnd()
+        {
+            if (_target == Target::KEY)
+            {
+                // Keys inside a captured value are part of that value
+                if (_capture == false)
+                {
+                    Field field = Field::NONE;
+                    if (_key == "name")
+                        field = Field::NAME;
+                    else if (_key == "value")
+                        field = Field::VALUE;
+
+                    if ((field != Field::NONE) && (_entryDepth != _scopes.size()))
+                    {
+                        _entryDepth = _scopes.size();
+                        _hasName = false;
+                        _name.clear();
+                        _value.clear();
+                    }
+                    _field = field;
+                }
+            }
+            else
+            {
+                if (_target == Target::NAME)
+                    _hasName = true;
+                ValueEnd();
+            }
+            _target = Target::DISCARD;
+        }
+
+        void ParamListParser::ValueStart(const bool isString)
+        {
+            const Field field = _field;
+
+            _field = Field::NONE;
+            if (isString == true)
+                _target = Target::DISCARD;
+
+            if (_capture == false)
+            {
+                if (field == Field::VALUE)
+                {
+                    _capture = true;
+                    _captureDepth = _scopes.size();
+                    _value.clear();
+                }
+                else if ((field == Field::NAME) && (isString == true))
+                {
+                    _target = Target::NAME;
+                    _name.clear();
+                }
+            }
+        }
+
+        void ParamListParser::ValueEnd()
+        {
+            if ((_capture == true) && (_scopes.size() == _captureDepth))
+                _capture = false;
+            _expect = Expect::COMMA_OR_END;
+        }
+
+        void ParamListParser::ObjectEnd()
+        {
+            if (_entryDepth == _scopes.size())
+            {
+                if (_hasName == true)
+                {
+                    _handler(_name, _value);
+                    _entries++;
+                }
+                _entryDepth = 0;
+                _hasName = false;
+                _name.clear();
+                _value.clear();
+            }
+        }
+
+        void ParamListParser::AppendCodePoint(uint32_t codePoint)
+        {
+            if ((codePoint >= 0xD800) && (codePoint <= 0xDBFF))
+            {
+                _highSurrogate = codePoint;
+                return;
+            }
+            if ((codePoint >= 0xDC00) && (codePoint <= 0xDFFF) && (_highSurrogate != 0))
+            {
+                codePoint = 0x10000 + ((_highSurrogate - 0xD800) << 10) + (codePoint - 0xDC00);
+            }
+            _highSurrogate = 0;
+
+            char utf8[4];
+            size_t length = 0;
+            if (codePoint < 0x80)
+            {
+                utf8[length++] = static_cast<char>(codePoint);
+            }
+            else if (codePoint < 0x800)
+            {
+                utf8[length++] = static_cast<char>(0xC0 | (codePoint >> 6));
+                utf8[length++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else if (codePoint < 0x10000)
+            {
+                utf8[length++] = static_cast<char>(0xE0 | (codePoint >> 12));
+                utf8[length++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                utf8[length++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else
+            {
+                utf8[length++] = static_cast<char>(0xF0 | (codePoint >> 18));
+                utf8[length++] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                utf8[length++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                utf8[length++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            Append(utf8, length);
+        }
+
+        void ParamListParser::Append(const char* data, const size_t length)
+        {
+            if (_target == Target::KEY)
+                _key.append(data, length);
+            else if (_target == Target::NAME)
+                _name.append(data, length);
+        }
+
+        void ParamListParser::Append(const char c)
+        {
+            Append(&c, 1);
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
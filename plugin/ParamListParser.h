@@ -0,0 +1,101 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Incremental tokenizer for the configuration backend response,
+         *   {"paramList":[{"name":"...","value":...}, ...], ...}
+         * fed straight from the curl write callback. Every object holding a
+         * "name" string is reported once it closes; the name is unescaped and
+         * the value is handed over verbatim as JSON text, which matches what
+         * the previous substring based parser returned. Bytes in front of the
+         * top level value are skipped and parsing stops on the first syntax
+         * error, keeping the entries reported so far. A response that errs or
+         * is truncated has to be discarded by the caller. */
+        class ParamListParser
+        {
+            public:
+                typedef std::function<void(std::string& name, std::string& value)> Handler;
+
+                explicit ParamListParser(const Handler& handler);
+                ~ParamListParser() = default;
+
+                ParamListParser(const ParamListParser&) = delete;
+                ParamListParser& operator=(const ParamListParser&) = delete;
+
+                void Reset();
+                void Feed(const char* data, const size_t length);
+
+                bool IsComplete() const { return _done; }
+                bool HasError() const { return _error; }
+                /* The top level value was opened but the input ended before it closed */
+                bool IsTruncated() const { return (_started && !_done && !_error); }
+                uint32_t Entries() const { return _entries; }
+
+            private:
+                enum class Scope : uint8_t { OBJECT, ARRAY };
+                enum class Expect : uint8_t { KEY, KEY_OR_END, COLON, VALUE, VALUE_OR_END, COMMA_OR_END };
+                enum class Field : uint8_t { NONE, NAME, VALUE };
+                enum class Target : uint8_t { DISCARD, KEY, NAME };
+
+                const char* String(const char* current, const char* end);
+                void StringEnd();
+                void ValueStart(const bool isString);
+                void ValueEnd();
+                void ObjectEnd();
+                void AppendCodePoint(uint32_t codePoint);
+                void Append(const char* data, const size_t length);
+                void Append(const char c);
+
+            private:
+                Handler _handler;
+                std::vector<Scope> _scopes;
+                Expect _expect;
+                Field _field;
+                Target _target;
+                bool _started;
+                bool _done;
+                bool _error;
+                bool _inString;
+                bool _inLiteral;
+                bool _escape;
+                uint8_t _unicode;
+                uint32_t _codePoint;
+                uint32_t _highSurrogate;
+                bool _capture;
+                size_t _captureDepth;
+                size_t _entryDepth;
+                bool _hasName;
+                std::string _key;
+                std::string _name;
+                std::string _value;
+                uint32_t _entries;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
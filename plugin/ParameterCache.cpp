@@ -0,0 +1,137 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "ParameterCache.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        constexpr uint32_t ParameterCache::Infinite;
+
+        ParameterCache::ParameterCache()
+            : _lock()
+            , _defaultTtl(0)
+            , _ttl()
+            , _entries()
+            , _generation(0)
+            , _statistics()
+        {
+        }
+
+        void ParameterCache::DefaultTtl(const uint32_t seconds)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _defaultTtl = seconds;
+        }
+
+        void ParameterCache::Ttl(const std::string& name, const uint32_t seconds)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _ttl[name] = seconds;
+            _entries.erase(name);
+        }
+
+        bool ParameterCache::Lookup(const std::string& name, std::string& value)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            auto index = _entries.find(name);
+            if (index != _entries.end())
+            {
+                if (index->second.immutable || (Clock::now() < index->second.expiry))
+                {
+                    value = index->second.value;
+                    _statistics.hits++;
+                    return true;
+                }
+                _entries.erase(index);
+            }
+
+            _statistics.misses++;
+            return false;
+        }
+
+        uint32_t ParameterCache::Generation() const
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _generation;
+        }
+
+        void ParameterCache::Store(const std::string& name, const std::string& value, const uint32_t generation)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            // invalidated while the value was being fetched
+            if (generation != _generation)
+            {
+                return;
+            }
+
+            // an empty value is not known yet, it must not be kept forever
+            const uint32_t ttl = TtlOf(name);
+            if ((ttl == 0) || ((ttl == Infinite) && IsEmpty(value)))
+            {
+                return;
+            }
+
+            Entry& entry = _entries[name];
+            entry.value = value;
+            entry.immutable = (ttl == Infinite);
+            entry.expiry = (entry.immutable ? Clock::time_point::max() : Clock::now() + std::chrono::seconds(ttl));
+        }
+
+        uint32_t ParameterCache::Invalidate(const std::string& name)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            uint32_t count = 0;
+
+            _generation++;
+
+            if (name.empty())
+            {
+                count = static_cast<uint32_t>(_entries.size());
+                _entries.clear();
+            }
+            else
+            {
+                count = static_cast<uint32_t>(_entries.erase(name));
+            }
+            return count;
+        }
+
+        ParameterCache::Statistics ParameterCache::GetStatistics() const
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _statistics;
+        }
+
+        uint32_t ParameterCache::TtlOf(const std::string& name) const
+        {
+            auto index = _ttl.find(name);
+            return (index != _ttl.end() ? index->second : _defaultTtl);
+        }
+
+        /* Values are JSON text as received from the backend */
+        bool ParameterCache::IsEmpty(const std::string& value)
+        {
+            return (value.empty() || (value == "\"\"") || (value == "null"));
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
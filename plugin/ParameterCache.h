@@ -0,0 +1,86 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Per-parameter value cache in front of the configuration backend.
+         * Every parameter gets a TTL in seconds: 0 disables caching (the
+         * default for unknown parameters) and Infinite keeps the value until
+         * it is invalidated explicitly. Every Invalidate starts a new
+         * generation; a value fetched under an older one is not stored. */
+        class ParameterCache
+        {
+            public:
+                static constexpr uint32_t Infinite = ~0u;
+
+                struct Statistics
+                {
+                    uint32_t hits;
+                    uint32_t misses;
+                };
+
+                ParameterCache();
+                ~ParameterCache() = default;
+
+                ParameterCache(const ParameterCache&) = delete;
+                ParameterCache& operator=(const ParameterCache&) = delete;
+
+                void DefaultTtl(const uint32_t seconds);
+                void Ttl(const std::string& name, const uint32_t seconds);
+
+                bool Lookup(const std::string& name, std::string& value);
+                uint32_t Generation() const;
+                void Store(const std::string& name, const std::string& value, const uint32_t generation);
+                uint32_t Invalidate(const std::string& name);
+
+                Statistics GetStatistics() const;
+
+            private:
+                typedef std::chrono::steady_clock Clock;
+
+                struct Entry
+                {
+                    std::string value;
+                    Clock::time_point expiry;
+                    bool immutable;
+                };
+
+                uint32_t TtlOf(const std::string& name) const;
+                static bool IsEmpty(const std::string& value);
+
+            private:
+                mutable std::mutex _lock;
+                uint32_t _defaultTtl;
+                std::map<std::string, uint32_t> _ttl;
+                std::map<std::string, Entry> _entries;
+                uint32_t _generation;
+                Statistics _statistics;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
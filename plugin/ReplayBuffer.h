@@ -0,0 +1,104 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* The last emitted events, so a subscriber coming back can be handed
+         * what it missed. EVENT carries its sequence number in a sequence
+         * member, and events are appended in sequence order. History before
+         * the horizon is unknown: everything up to the sequence number the
+         * buffer started at, and every event evicted since.
+         * Not thread safe, the caller serializes access. */
+        template <typename EVENT>
+        class ReplayBuffer
+        {
+            public:
+                ReplayBuffer(const uint32_t capacity, const uint64_t horizon)
+                    : _capacity(capacity)
+                    , _horizon(horizon)
+                    , _last(horizon)
+                    , _events()
+                    , _evicted(0)
+                {
+                }
+                ~ReplayBuffer() = default;
+
+                ReplayBuffer(const ReplayBuffer&) = delete;
+                ReplayBuffer& operator=(const ReplayBuffer&) = delete;
+
+                void Append(const EVENT& event)
+                {
+                    _events.push_back(event);
+                    _last = event.sequence;
+                    Trim();
+                }
+
+                /* Appends the events after since to events, oldest first.
+                 * False if some of them are gone, or since was never issued
+                 * by this buffer */
+                bool Since(const uint64_t since, std::vector<EVENT>& events) const
+                {
+                    for (const EVENT& event : _events)
+                    {
+                        if (event.sequence > since)
+                        {
+                            events.push_back(event);
+                        }
+                    }
+                    return ((since >= _horizon) && (since <= _last));
+                }
+
+                /* A smaller capacity evicts the oldest events right away */
+                void Configure(const uint32_t capacity)
+                {
+                    _capacity = capacity;
+                    Trim();
+                }
+
+                uint64_t Last() const { return _last; }
+                uint32_t Evicted() const { return _evicted; }
+
+            private:
+                void Trim()
+                {
+                    while (_events.size() > _capacity)
+                    {
+                        _horizon = _events.front().sequence;
+                        _events.pop_front();
+                        _evicted++;
+                    }
+                }
+
+            private:
+                uint32_t _capacity;
+                uint64_t _horizon;
+                uint64_t _last;
+                std::deque<EVENT> _events;
+                uint32_t _evicted;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,106 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Sequence lock for a small trivially copyable value: readers never
+         * block and never write shared memory, they retry while a store is in
+         * progress. The value is kept in atomic words so a torn read is only
+         * ever discarded, never undefined. Stores are serialized among
+         * themselves, meant for a single publisher with the odd extra one. */
+        template <typename VALUE>
+        class SeqLock
+        {
+            static_assert(std::is_trivially_copyable<VALUE>::value, "SeqLock needs a trivially copyable value");
+
+            public:
+                SeqLock()
+                    : _writer()
+                    , _sequence(0)
+                {
+                    for (std::atomic<uint64_t>& word : _words)
+                    {
+                        word.store(0, std::memory_order_relaxed);
+                    }
+                }
+                ~SeqLock() = default;
+
+                SeqLock(const SeqLock&) = delete;
+                SeqLock& operator=(const SeqLock&) = delete;
+
+                void Store(const VALUE& value)
+                {
+                    uint64_t words[Words] = {};
+                    memcpy(words, &value, sizeof(VALUE));
+
+                    std::lock_guard<std::mutex> lock(_writer);
+                    const uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+
+                    // odd while the words are being replaced
+                    _sequence.store(sequence + 1, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_release);
+                    for (uint32_t index = 0; index < Words; index++)
+                    {
+                        _words[index].store(words[index], std::memory_order_relaxed);
+                    }
+                    _sequence.store(sequence + 2, std::memory_order_release);
+                }
+
+                VALUE Load() const
+                {
+                    uint64_t words[Words];
+                    uint32_t before;
+                    uint32_t after;
+
+                    do
+                    {
+                        before = _sequence.load(std::memory_order_acquire);
+                        for (uint32_t index = 0; index < Words; index++)
+                        {
+                            words[index] = _words[index].load(std::memory_order_relaxed);
+                        }
+                        std::atomic_thread_fence(std::memory_order_acquire);
+                        after = _sequence.load(std::memory_order_relaxed);
+                    } while (((before & 1) != 0) || (before != after));
+
+                    VALUE value;
+                    memcpy(&value, words, sizeof(VALUE));
+                    return value;
+                }
+
+            private:
+                static constexpr uint32_t Words = (sizeof(VALUE) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+                std::mutex _writer;
+                std::atomic<uint32_t> _sequence;
+                std::atomic<uint64_t> _words[Words];
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
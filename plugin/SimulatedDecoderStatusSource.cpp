@@ -0,0 +1,232 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#include "SimulatedDecoderStatusSource.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        static const char* const stateNames[] = { "IDLE", "PAUSED", "ACTIVE" };
+
+        SimulatedDecoderStatusSource::SimulatedDecoderStatusSource(const std::string& trace, const uint32_t speed, const uint32_t repeat, const Clock& clock)
+            : _trace(trace)
+            , _speed(speed)
+            , _repeat(repeat)
+            , _clock(clock)
+            , _steps()
+            , _decoders()
+            , _states()
+            , _length(0)
+            , _start(0)
+            , _lap(0)
+            , _next(0)
+            , _errorLine(0)
+        {
+        }
+
+        bool SimulatedDecoderStatusSource::Open()
+        {
+            std::ifstream trace(_trace);
+            if (!trace.is_open())
+            {
+                return false;
+            }
+            return Load(trace);
+        }
+
+        bool SimulatedDecoderStatusSource::Load(std::istream& trace)
+        {
+            std::string line;
+            uint32_t number = 0;
+            uint64_t end = 0;
+
+            _steps.clear();
+            _decoders.clear();
+            _errorLine = 0;
+
+            while (std::getline(trace, line))
+            {
+                number++;
+
+                const size_t comment = line.find('#');
+                if (comment != std::string::npos)
+                {
+                    line.erase(comment);
+                }
+
+                std::istringstream fields(line);
+                uint64_t time;
+                std::string type;
+                if (!(fields >> time))
+                {
+                    // blank or comment only
+                    if (line.find_first_not_of(" \t\r") == std::string::npos)
+                    {
+                        continue;
+                    }
+                    _errorLine = number;
+                    break;
+                }
+                if (!(fields >> type))
+                {
+                    _errorLine = number;
+                    break;
+                }
+                if (type == "end")
+                {
+                    end = time;
+                    continue;
+                }
+
+                uint32_t id;
+                std::string name;
+                if ((type != "video") && (type != "audio"))
+                {
+                    _errorLine = number;
+                    break;
+                }
+                if (!(fields >> id >> name))
+                {
+                    _errorLine = number;
+                    break;
+                }
+                const char* const* state = std::find(std::begin(stateNames), std::end(stateNames), name);
+                if (state == std::end(stateNames))
+                {
+                    _errorLine = number;
+                    break;
+                }
+
+                Step step;
+                step.time = time;
+                step.decoder = Index(type == "video" ? VIDEO : AUDIO, id);
+                step.state = static_cast<int>(state - std::begin(stateNames));
+                _steps.push_back(step);
+            }
+
+            // steps at the same time keep their order in the file
+            std::stable_sort(_steps.begin(), _steps.end(), [](const Step& a, const Step& b) { return a.time < b.time; });
+
+            _length = std::max(end, (_steps.empty() ? 0 : _steps.back().time));
+            _states.assign(_decoders.size(), IDLE);
+            _start = _clock();
+            _lap = 0;
+            _next = 0;
+
+            return (_errorLine == 0);
+        }
+
+        void SimulatedDecoderStatusSource::Decoders(std::vector<Decoder>& decoders)
+        {
+            decoders.insert(decoders.end(), _decoders.begin(), _decoders.end());
+        }
+
+        int SimulatedDecoderStatusSource::MostActive()
+        {
+            Advance();
+
+            int status = IDLE;
+            for (const int state : _states)
+            {
+                status = std::max(status, state);
+            }
+            return status;
+        }
+
+        bool SimulatedDecoderStatusSource::DecoderState(const Type type, const uint32_t id, int& state)
+        {
+            Advance();
+
+            for (size_t index = 0; index < _decoders.size(); index++)
+            {
+                if ((_decoders[index].type == type) && (_decoders[index].id == id))
+                {
+                    state = _states[index];
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        uint32_t SimulatedDecoderStatusSource::Index(const Type type, const uint32_t id)
+        {
+            for (size_t index = 0; index < _decoders.size(); index++)
+            {
+                if ((_decoders[index].type == type) && (_decoders[index].id == id))
+                {
+                    return static_cast<uint32_t>(index);
+                }
+            }
+            _decoders.push_back({ type, id });
+            return static_cast<uint32_t>(_decoders.size() - 1);
+        }
+
+        void SimulatedDecoderStatusSource::Advance()
+        {
+            const uint64_t elapsed = ((_clock() - _start) * _speed) / 100;
+            uint64_t lap = 0;
+            uint64_t position = elapsed;
+
+            if (_length > 0)
+            {
+                lap = elapsed / _length;
+                position = elapsed % _length;
+                if ((_repeat != 0) && (lap >= _repeat))
+                {
+                    lap = _repeat - 1;
+                    position = _length;
+                }
+            }
+
+            if (lap != _lap)
+            {
+                // finish the lap, one more full lap sets the same states as any number of them
+                Play(_next, _steps.size());
+                if (lap - _lap > 1)
+                {
+                    Play(0, _steps.size());
+                }
+                _lap = lap;
+                _next = 0;
+            }
+
+            size_t next = _next;
+            while ((next < _steps.size()) && (_steps[next].time <= position))
+            {
+                next++;
+            }
+            Play(_next, next);
+            _next = next;
+        }
+
+        void SimulatedDecoderStatusSource::Play(const size_t from, const size_t to)
+        {
+            for (size_t index = from; index < to; index++)
+            {
+                _states[_steps[index].decoder] = _steps[index].state;
+            }
+        }
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,101 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "DecoderStatusSource.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Replays a decoder transition trace instead of asking the hardware,
+         * so the poll and event path can be driven on any Linux box. One step
+         * per line, times in ms from the start of the trace:
+         *
+         *     # comment
+         *     0    video 0 ACTIVE
+         *     40   audio 0 ACTIVE
+         *     5000 video 0 PAUSED
+         *     6000 end
+         *
+         * The optional end line sets the length of a lap, otherwise it is the
+         * time of the last step. Steps play at speed percent of real time and
+         * the trace is replayed repeat times, 0 for ever; after the last lap
+         * the decoders keep their final states. Decoders start IDLE and carry
+         * their states over into the next lap. States are worked out from the
+         * clock when they are read, so nothing runs in the background. */
+        class SimulatedDecoderStatusSource : public DecoderStatusSource
+        {
+            public:
+                typedef std::function<uint64_t()> Clock;  // ms, monotonic
+
+                SimulatedDecoderStatusSource(const std::string& trace, const uint32_t speed, const uint32_t repeat, const Clock& clock);
+                ~SimulatedDecoderStatusSource() override = default;
+
+                SimulatedDecoderStatusSource(const SimulatedDecoderStatusSource&) = delete;
+                SimulatedDecoderStatusSource& operator=(const SimulatedDecoderStatusSource&) = delete;
+
+                /* Reads the trace file and starts the replay */
+                bool Open() override;
+                void Decoders(std::vector<Decoder>& decoders) override;
+                int MostActive() override;
+                bool DecoderState(const Type type, const uint32_t id, int& state) override;
+
+                /* Replaces the trace and restarts the replay, false on the first line not understood */
+                bool Load(std::istream& trace);
+
+                /* Line of the last Load error, 0 if there was none */
+                uint32_t ErrorLine() const { return _errorLine; }
+
+            private:
+                struct Step
+                {
+                    uint64_t time;
+                    uint32_t decoder;   // index into _decoders
+                    int state;
+                };
+
+                uint32_t Index(const Type type, const uint32_t id);
+                void Advance();
+                void Play(const size_t from, const size_t to);
+
+            private:
+                const std::string _trace;
+                const uint32_t _speed;
+                const uint32_t _repeat;
+                const Clock _clock;
+                std::vector<Step> _steps;
+                std::vector<Decoder> _decoders;
+                std::vector<int> _states;
+                uint64_t _length;
+                uint64_t _start;
+                uint64_t _lap;
+                size_t _next;
+                uint32_t _errorLine;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,104 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Collapses concurrent calls for the same key into one: the first
+         * caller runs the fetch, callers arriving while it is in flight wait
+         * for it and share its result. Nothing is kept once the call is done. */
+        template <typename RESULT>
+        class SingleFlight
+        {
+            public:
+                typedef std::shared_ptr<const RESULT> Result;
+
+                SingleFlight()
+                    : _lock()
+                    , _signal()
+                    , _calls()
+                    , _coalesced(0)
+                {
+                }
+                ~SingleFlight() = default;
+
+                SingleFlight(const SingleFlight&) = delete;
+                SingleFlight& operator=(const SingleFlight&) = delete;
+
+                Result Run(const std::string& key, const std::function<RESULT()>& fetch, bool& coalesced)
+                {
+                    std::unique_lock<std::mutex> lock(_lock);
+
+                    auto index = _calls.find(key);
+                    if (index != _calls.end())
+                    {
+                        std::shared_ptr<Call> call = index->second;
+                        _coalesced++;
+                        coalesced = true;
+                        _signal.wait(lock, [&call]() { return (call->result != nullptr); });
+                        return call->result;
+                    }
+
+                    std::shared_ptr<Call> call = std::make_shared<Call>();
+                    _calls.emplace(key, call);
+                    coalesced = false;
+                    lock.unlock();
+
+                    Result result = std::make_shared<const RESULT>(fetch());
+
+                    lock.lock();
+                    call->result = result;
+                    _calls.erase(key);
+                    lock.unlock();
+                    _signal.notify_all();
+
+                    return result;
+                }
+
+                uint32_t Coalesced() const
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    return _coalesced;
+                }
+
+            private:
+                struct Call
+                {
+                    Result result;
+                };
+
+            private:
+                mutable std::mutex _lock;
+                std::condition_variable _signal;
+                std::map<std::string, std::shared_ptr<Call>> _calls;
+                uint32_t _coalesced;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,184 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* What one subscriber wants to receive, checked before an event is
+         * queued for it. Event types and statuses are bit masks, 0 lets all
+         * through; statuses only apply to events that report one. With a
+         * minimum interval an event arriving too soon after the previous one
+         * is dropped, unless it reports a state: then the latest one per key
+         * is held back until the interval is over, so the subscriber still
+         * ends up with the current state. Times are ms on a monotonic clock. */
+        template <typename EVENT>
+        class SubscriberFilter
+        {
+            public:
+                enum Verdict
+                {
+                    PASS,       // queue it now
+                    HOLD,       // held back until Deadline
+                    DROP
+                };
+
+                SubscriberFilter(const uint8_t events, const uint8_t states, const uint32_t interval)
+                    : _lock()
+                    , _events(events)
+                    , _states(states)
+                    , _interval(interval)
+                    , _next(0)
+                    , _held()
+                    , _flushPending(false)
+                    , _filtered(0)
+                {
+                }
+                ~SubscriberFilter() = default;
+
+                SubscriberFilter(const SubscriberFilter&) = delete;
+                SubscriberFilter& operator=(const SubscriberFilter&) = delete;
+
+                /* True if nothing is ever filtered, the dispatcher skips the checks */
+                bool Open() const
+                {
+                    return ((_events == 0) && (_states == 0) && (_interval == 0));
+                }
+
+                /* type and state are single bits, state 0 if the event has none.
+                 * schedule tells the caller to arrange a Flush at Deadline */
+                Verdict Offer(const EVENT& event, const uint8_t type, const uint8_t state, const std::string& key, const uint64_t now, bool& schedule)
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+
+                    schedule = false;
+                    if (((_events != 0) && ((_events & type) == 0)) || ((state != 0) && (_states != 0) && ((_states & state) == 0)))
+                    {
+                        _filtered++;
+                        return DROP;
+                    }
+                    if (_interval == 0)
+                    {
+                        return PASS;
+                    }
+
+                    typename Held::iterator index = Find(key);
+                    if (now >= _next)
+                    {
+                        // a held state this one overrides must not follow it
+                        if (index != _held.end())
+                        {
+                            _held.erase(index);
+                            _filtered++;
+                        }
+                        _next = now + _interval;
+                        return PASS;
+                    }
+
+                    if (key.empty())
+                    {
+                        _filtered++;
+                        return DROP;
+                    }
+                    if (index != _held.end())
+                    {
+                        index->second = event;
+                        _filtered++;
+                    }
+                    else
+                    {
+                        _held.emplace_back(key, event);
+                    }
+                    if (!_flushPending)
+                    {
+                        _flushPending = true;
+                        schedule = true;
+                    }
+                    return HOLD;
+                }
+
+                /* Moves the held events to events once the interval is over,
+                 * false if it is not over yet */
+                bool Flush(const uint64_t now, std::vector<EVENT>& events)
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+
+                    if (now < _next)
+                    {
+                        return false;
+                    }
+                    for (std::pair<std::string, EVENT>& held : _held)
+                    {
+                        events.push_back(std::move(held.second));
+                    }
+                    _held.clear();
+                    _flushPending = false;
+                    if (!events.empty())
+                    {
+                        _next = now + _interval;
+                    }
+                    return true;
+                }
+
+                uint64_t Deadline() const
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    return _next;
+                }
+
+                /* Events dropped, or replaced while held back */
+                uint32_t Filtered() const
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    return _filtered;
+                }
+
+            private:
+                typedef std::vector<std::pair<std::string, EVENT>> Held;
+
+                typename Held::iterator Find(const std::string& key)
+                {
+                    typename Held::iterator index = _held.begin();
+                    while ((index != _held.end()) && ((key.empty()) || (index->first != key)))
+                    {
+                        index++;
+                    }
+                    return index;
+                }
+
+            private:
+                mutable std::mutex _lock;
+                const uint8_t _events;
+                const uint8_t _states;
+                const uint32_t _interval;
+                uint64_t _next;
+                Held _held;
+                bool _flushPending;
+                uint32_t _filtered;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
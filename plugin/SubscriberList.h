@@ -0,0 +1,112 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /* Copy-on-write list of registered notification sinks. Add and Remove
+         * build a new immutable version and publish it atomically, Get hands
+         * out the current version without locking. Entries are shared, so an
+         * entry removed from the list lives on, and keeps its sink referenced,
+         * until the last version or delivery holding it has finished with it.
+         * ENTRY::Sink() identifies the registered sink. */
+        template <typename ENTRY>
+        class SubscriberList
+        {
+            public:
+                typedef std::vector<std::shared_ptr<ENTRY>> List;
+                typedef std::shared_ptr<const List> Snapshot;
+
+                SubscriberList()
+                    : _writerLock()
+                    , _list(std::make_shared<const List>())
+                {
+                }
+                ~SubscriberList() = default;
+
+                SubscriberList(const SubscriberList&) = delete;
+                SubscriberList& operator=(const SubscriberList&) = delete;
+
+                /* False if the sink is registered already */
+                bool Add(const std::shared_ptr<ENTRY>& entry)
+                {
+                    std::lock_guard<std::mutex> lock(_writerLock);
+                    const Snapshot current = std::atomic_load(&_list);
+
+                    if (Find(*current, entry->Sink()) != current->end())
+                    {
+                        return false;
+                    }
+
+                    std::shared_ptr<List> next = std::make_shared<List>(*current);
+                    next->push_back(entry);
+                    std::atomic_store(&_list, Snapshot(std::move(next)));
+                    return true;
+                }
+
+                /* The removed entry, empty if the sink is not registered */
+                std::shared_ptr<ENTRY> Remove(const void* sink)
+                {
+                    // declared first so the sink is released after the lock is
+                    Snapshot previous;
+                    std::lock_guard<std::mutex> lock(_writerLock);
+
+                    previous = std::atomic_load(&_list);
+                    typename List::const_iterator index = Find(*previous, sink);
+                    if (index == previous->end())
+                    {
+                        return std::shared_ptr<ENTRY>();
+                    }
+                    std::shared_ptr<ENTRY> removed = *index;
+
+                    std::shared_ptr<List> next = std::make_shared<List>();
+                    next->reserve(previous->size() - 1);
+                    next->insert(next->end(), previous->begin(), index);
+                    next->insert(next->end(), index + 1, previous->end());
+                    std::atomic_store(&_list, Snapshot(std::move(next)));
+                    return removed;
+                }
+
+                Snapshot Get() const
+                {
+                    return std::atomic_load(&_list);
+                }
+
+            private:
+                static typename List::const_iterator Find(const List& list, const void* sink)
+                {
+                    return std::find_if(list.begin(), list.end(),
+                        [sink](const std::shared_ptr<ENTRY>& entry) { return (entry->Sink() == sink); });
+                }
+
+            private:
+                std::mutex _writerLock;
+                Snapshot _list;
+        };
+    } // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,284 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2025 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <interfaces/Ids.h>
+#include <interfaces/IDeviceDiagnostics.h>
+
+// @stubgen:include <com/IIteratorType.h>
+
+namespace WPEFramework
+{
+    namespace Exchange
+    {
+        /* @json 1.0.0 @text:keep */
+        struct EXTERNAL IDeviceDiagnosticsExt : virtual public Core::IUnknown
+        {
+            enum { ID = ID_DEVICE_DIAGNOSTICS_EXT };
+
+            // @event
+            struct EXTERNAL INotification : virtual public Core::IUnknown
+            {
+                enum { ID = ID_DEVICE_DIAGNOSTICS_EXT_NOTIFICATION };
+
+                // @text onConfigurationResult
+                // @brief Triggered when a getConfigurationAsync request completes
+                // @param requestId: Id returned by getConfigurationAsync
+                // @param success: Whether the configuration backend answered the request
+                // @param paramList: JSON array of name/value objects, same content as getConfiguration returns
+                // @param sequence: Event sequence number
+                // @param timestamp: When the event was emitted, in milliseconds since the epoch
+                virtual void OnConfigurationResult(const uint32_t requestId, const bool success, const string& paramList /* @opaque */, const uint64_t sequence, const uint64_t timestamp) {};
+
+                // @text onMilestoneLogged
+                // @brief Triggered when milestones are appended to the milestone log
+                // @param milestones: JSON array of the new milestone lines in log order, one line unless batching is configured
+                // @param sequence: Event sequence number
+                // @param timestamp: When the event was emitted, in milliseconds since the epoch
+                virtual void OnMilestoneLogged(const string& milestones /* @opaque */, const uint64_t sequence, const uint64_t timestamp) {};
+
+                // @text onDecoderStateChanged
+                // @brief Triggered when the poll thread sees one decoder change state
+                // @param type: Decoder type: video or audio
+                // @param id: Decoder index within its type
+                // @param status: New decoder status: IDLE, PAUSED or ACTIVE
+                // @param sequence: Event sequence number
+                // @param timestamp: When the change was seen, in milliseconds since the epoch
+                virtual void OnDecoderStateChanged(const string& type, const uint32_t id, const string& status, const uint64_t sequence, const uint64_t timestamp) {};
+
+                // @json:omit
+                // @text onAVDecoderStatus
+                // @brief Triggered along with onAVDecoderStatusChanged, numbered in the same sequence as the other events, COM-RPC only
+                // @param status: Status of the most active decoder: IDLE, PAUSED or ACTIVE
+                // @param sequence: Event sequence number
+                // @param timestamp: When the event was emitted, in milliseconds since the epoch
+                virtual void OnAVDecoderStatus(const string& status, const uint64_t sequence, const uint64_t timestamp) {};
+            };
+
+            virtual Core::hresult Register(IDeviceDiagnosticsExt::INotification* notification /* @in */) = 0;
+
+            enum EventType : uint8_t {
+                EVENT_AV_DECODER_STATUS = 0x01,
+                EVENT_DECODER_STATE = 0x02,
+                EVENT_CONFIGURATION_RESULT = 0x04,
+                EVENT_MILESTONE_LOGGED = 0x08
+            };
+
+            enum EventState : uint8_t {
+                STATE_IDLE = 0x01,
+                STATE_PAUSED = 0x02,
+                STATE_ACTIVE = 0x04
+            };
+
+            struct EXTERNAL EventFilter
+            {
+                uint8_t events /* @text events @brief EventType bits of the events to deliver, 0 for all */;
+                uint8_t states /* @text states @brief EventState bits of the statuses to deliver for AV status and decoder state events, 0 for all */;
+                uint32_t minInterval /* @text minInterval @brief Least milliseconds between two deliveries, 0 for no limit; a state arriving sooner is delivered late, other events are dropped */;
+            };
+
+            // @json:omit
+            // @brief Registers for the notifications the filter lets through, filtered-out events are never marshalled
+            // @param filter: Event types, statuses and delivery rate wanted
+            virtual Core::hresult RegisterFiltered(IDeviceDiagnosticsExt::INotification* notification /* @in */, const EventFilter& filter /* @in */) = 0;
+
+            // @json:omit
+            // @brief Registers for notifications, first replaying the events sent after the given sequence number
+            // @param since: Sequence number of the last event the client has seen
+            // @param complete: False if some events after since were lost, the latest state of every decoder is replayed instead
+            virtual Core::hresult RegisterSince(IDeviceDiagnosticsExt::INotification* notification /* @in */, const uint64_t since /* @in */, bool& complete /* @out */) = 0;
+            virtual Core::hresult Unregister(IDeviceDiagnosticsExt::INotification* notification /* @in */) = 0;
+
+            struct EXTERNAL ConfigurationStatistics
+            {
+                uint32_t requests /* @text requests @brief Number of requests sent to the configuration backend */;
+                uint32_t reusedConnections /* @text reusedConnections @brief Requests served on an already open keep-alive connection */;
+                uint32_t newConnections /* @text newConnections @brief Connections opened to the configuration backend */;
+                uint64_t waitTimeUs /* @text waitTimeUs @brief Total time callers waited for a free connection, in microseconds */;
+                uint32_t cacheHits /* @text cacheHits @brief Parameters served from the value cache */;
+                uint32_t cacheMisses /* @text cacheMisses @brief Parameters that had to be fetched from the backend */;
+                uint32_t coalescedCalls /* @text coalescedCalls @brief Calls that shared the backend round-trip of an identical request in flight */;
+            };
+
+            // @text getConfigurationStatistics
+            // @brief Gets the counters of the configuration backend connection pool, value cache and request coalescing
+            // @param statistics: Connection pool and cache counters
+            virtual Core::hresult GetConfigurationStatistics(ConfigurationStatistics& statistics /* @out */) = 0;
+
+            // @text invalidateConfigurationCache
+            // @brief Drops cached configuration values so the next request goes to the backend
+            // @param name: Parameter to invalidate, empty string invalidates every parameter
+            // @param invalidated: Number of cached values dropped
+            virtual Core::hresult InvalidateConfigurationCache(const string& name, uint32_t& invalidated /* @out */) = 0;
+
+            // @text getConfigurationAsync
+            // @brief Starts a getConfiguration request without waiting for the backend, the result follows in onConfigurationResult
+            // @param names: Parameters to fetch
+            // @param requestId: Id that identifies the result event
+            virtual Core::hresult GetConfigurationAsync(RPC::IStringIterator* const& names /* @in */, uint32_t& requestId /* @out */) = 0;
+
+            // @text queryMilestones
+            // @brief Gets the milestones matching a filter, one page at a time
+            // @param since: Earliest milestone time in milliseconds (epoch for dated lines, uptime for MARKER:uptime lines), 0 for no bound
+            // @param until: Latest milestone time in milliseconds, inclusive, 0 for no bound
+            // @param prefix: Only milestones whose marker starts with this text, empty for all
+            // @param contains: Only milestones whose line contains this text, empty for all
+            // @param offset: Number of matching milestones to skip
+            // @param limit: Maximum number of milestones to return, 0 for all
+            // @param milestones: Matching milestone lines of the requested page
+            // @param total: Number of matching milestones across all pages
+            virtual Core::hresult QueryMilestones(const uint64_t since, const uint64_t until, const string& prefix, const string& contains,
+                const uint32_t offset, const uint32_t limit, RPC::IStringIterator*& milestones /* @out */, uint32_t& total /* @out */) = 0;
+
+            // @text logMilestones
+            // @brief Logs several milestones with one call, in the given order
+            // @param markers: Milestone markers, none of them may be empty
+            // @param success: Whether all markers were queued for the milestone log
+            virtual Core::hresult LogMilestones(RPC::IStringIterator* const& markers /* @in */, bool& success /* @out */) = 0;
+
+            struct EXTERNAL DecoderPollMode
+            {
+                string mode /* @text mode @brief Decoder status the poller was in: IDLE, PAUSED or ACTIVE */;
+                uint32_t wakeups /* @text wakeups @brief Polls made in this mode */;
+                uint32_t wakeupsPerHour /* @text wakeupsPerHour @brief Polls per hour spent in this mode */;
+                uint32_t transitions /* @text transitions @brief Status changes detected while in this mode */;
+                uint32_t averageLatencyMs /* @text averageLatencyMs @brief Average upper bound on how late those changes were detected */;
+                uint32_t maxLatencyMs /* @text maxLatencyMs @brief Largest upper bound on how late a change was detected */;
+            };
+
+            using IDecoderPollModeIterator = RPC::IIteratorType<DecoderPollMode, ID_DEVICE_DIAGNOSTICS_EXT_DECODER_POLL_ITERATOR>;
+
+            // @text getDecoderPollStatistics
+            // @brief Gets the cost and detection latency of the adaptive AV decoder status polling, per decoder status
+            // @param modes: Poll counters for IDLE, PAUSED and ACTIVE
+            // @param interval: Current poll interval in milliseconds
+            virtual Core::hresult GetDecoderPollStatistics(IDecoderPollModeIterator*& modes /* @out */, uint32_t& interval /* @out */) = 0;
+
+            struct EXTERNAL AVDecoderStatusSnapshot
+            {
+                string avDecoderStatus /* @text avDecoderStatus @brief Most active decoder status: IDLE, PAUSED or ACTIVE */;
+                uint64_t timestamp /* @text timestamp @brief When the status was read, in milliseconds since the epoch */;
+            };
+
+            // @text getAVDecoderStatusSnapshot
+            // @brief Gets the decoder status published by the last poll, or reads it live
+            // @param fresh: Query the resource manager now instead of returning the last poll result
+            // @param snapshot: Decoder status and the time it was read
+            virtual Core::hresult GetAVDecoderStatusSnapshot(const bool fresh, AVDecoderStatusSnapshot& snapshot /* @out */) = 0;
+
+            struct EXTERNAL DecoderState
+            {
+                string type /* @text type @brief Decoder type: video or audio */;
+                uint32_t id /* @text id @brief Decoder index within its type */;
+                string status /* @text status @brief Decoder status: IDLE, PAUSED or ACTIVE */;
+                uint64_t lastTransition /* @text lastTransition @brief When the status last changed, in milliseconds since the epoch, 0 if it has not changed since start */;
+            };
+
+            using IDecoderStateIterator = RPC::IIteratorType<DecoderState, ID_DEVICE_DIAGNOSTICS_EXT_DECODER_STATE_ITERATOR>;
+
+            // @text getDecoderStates
+            // @brief Gets the status of every audio and video decoder as of the last poll
+            // @param decoders: One entry per decoder, video decoders first
+            virtual Core::hresult GetDecoderStates(IDecoderStateIterator*& decoders /* @out */) = 0;
+
+            struct EXTERNAL DecoderStateHistory
+            {
+                string status /* @text status @brief Decoder status: IDLE, PAUSED or ACTIVE */;
+                uint64_t timeMs /* @text timeMs @brief Time spent in the status within the covered window, in milliseconds */;
+                uint32_t dutyCycle /* @text dutyCycle @brief Share of the covered window spent in the status, in hundredths of a percent */;
+                uint32_t episodes /* @text episodes @brief Stretches in the status overlapping the window */;
+                uint32_t p50Ms /* @text p50Ms @brief Median stretch length in milliseconds */;
+                uint32_t p90Ms /* @text p90Ms @brief 90th percentile stretch length in milliseconds */;
+                uint32_t p99Ms /* @text p99Ms @brief 99th percentile stretch length in milliseconds */;
+                uint32_t maxMs /* @text maxMs @brief Longest stretch in milliseconds */;
+            };
+
+            using IDecoderStateHistoryIterator = RPC::IIteratorType<DecoderStateHistory, ID_DEVICE_DIAGNOSTICS_EXT_DECODER_HISTORY_ITERATOR>;
+
+            // @text getDecoderHistory
+            // @brief Gets time in state, duty cycle and stretch length percentiles of the most active decoder status over a window
+            // @param window: Window length in seconds ending now, 0 for all recorded history
+            // @param states: Statistics for IDLE, PAUSED and ACTIVE
+            // @param coveredMs: Part of the window the history reaches back to, in milliseconds
+            // @param transitions: Status changes inside the covered window
+            virtual Core::hresult GetDecoderHistory(const uint32_t window, IDecoderStateHistoryIterator*& states /* @out */, uint64_t& coveredMs /* @out */, uint32_t& transitions /* @out */) = 0;
+
+            // @text getDecoderEventStatistics
+            // @brief Gets how many AV decoder status changes were sent to subscribers and how many the debounce window held back
+            // @param sent: onAVDecoderStatusChanged events sent
+            // @param suppressed: Status changes folded into a later event, or dropped because the status ended where it started
+            virtual Core::hresult GetDecoderEventStatistics(uint32_t& sent /* @out */, uint32_t& suppressed /* @out */) = 0;
+
+            struct EXTERNAL SubscriberStatistics
+            {
+                uint32_t id /* @text id @brief Registration number, in registration order */;
+                string interface /* @text interface @brief Interface the notification is registered on: IDeviceDiagnostics or IDeviceDiagnosticsExt */;
+                uint32_t queued /* @text queued @brief Events waiting to be delivered */;
+                uint32_t maxQueued /* @text maxQueued @brief Most events that were waiting at once */;
+                uint32_t delivered /* @text delivered @brief Events delivered */;
+                uint32_t dropped /* @text dropped @brief Events dropped because the queue was full */;
+                uint32_t coalesced /* @text coalesced @brief Queued events replaced by a newer one because the queue was full */;
+                uint32_t filtered /* @text filtered @brief Events the subscriber's filter kept from it */;
+                uint32_t averageLatencyUs /* @text averageLatencyUs @brief Average time from an event being queued to its delivery returning, in microseconds */;
+                uint32_t maxLatencyUs /* @text maxLatencyUs @brief Longest time from an event being queued to its delivery returning, in microseconds */;
+            };
+
+            using ISubscriberStatisticsIterator = RPC::IIteratorType<SubscriberStatistics, ID_DEVICE_DIAGNOSTICS_EXT_SUBSCRIBER_ITERATOR>;
+
+            // @text getSubscriberStatistics
+            // @brief Gets the delivery queue of every registered notification
+            // @param subscribers: One entry per registered notification
+            // @param disconnected: Notifications dropped because their queue overflowed with the disconnect policy
+            virtual Core::hresult GetSubscriberStatistics(ISubscriberStatisticsIterator*& subscribers /* @out */, uint32_t& disconnected /* @out */) = 0;
+
+            struct EXTERNAL MethodMetrics
+            {
+                string method /* @text method @brief IDeviceDiagnostics method name */;
+                uint32_t calls /* @text calls @brief Calls completed */;
+                uint32_t errors /* @text errors @brief Completed calls that returned an error */;
+                uint32_t inFlight /* @text inFlight @brief Calls in progress */;
+                uint32_t averageUs /* @text averageUs @brief Average call duration, in microseconds */;
+                uint32_t p50Us /* @text p50Us @brief Median call duration, in microseconds, within 1/16th */;
+                uint32_t p90Us /* @text p90Us @brief 90th percentile call duration, in microseconds, within 1/16th */;
+                uint32_t p99Us /* @text p99Us @brief 99th percentile call duration, in microseconds, within 1/16th */;
+                uint32_t maxUs /* @text maxUs @brief Longest call, in microseconds */;
+            };
+
+            using IMethodMetricsIterator = RPC::IIteratorType<MethodMetrics, ID_DEVICE_DIAGNOSTICS_EXT_METRICS_ITERATOR>;
+
+            // @text getMetrics
+            // @brief Gets call counts and latency percentiles of every IDeviceDiagnostics method
+            // @param reset: Start counting afresh once read, calls in progress are kept
+            // @param methods: One entry per method
+            virtual Core::hresult GetMetrics(const bool reset /* @in */, IMethodMetricsIterator*& methods /* @out */) = 0;
+
+            // @text setMethodTrace
+            // @brief Turns logging of the parameters and result of one method on or off
+            // @param method: Method name, matched without regard to case, or * for every method
+            // @param enabled: Whether calls to the method are logged
+            virtual Core::hresult SetMethodTrace(const string& method /* @in */, const bool enabled /* @in */) = 0;
+
+            // @text getMethodTrace
+            // @brief Gets the methods whose parameters and results are logged
+            // @param methods: Names as given to setMethodTrace
+            virtual Core::hresult GetMethodTrace(RPC::IStringIterator*& methods /* @out */) = 0;
+        };
+    } // namespace Exchange
+} // namespace WPEFramework